@@ -18,6 +18,7 @@
 
 #include <map>
 
+#include "apn_state_aggregate.h"
 #include "connection_retry_policy.h"
 #include "net_supplier_callback_base.h"
 
@@ -60,6 +61,7 @@ public:
     static bool IsCompatibleApnItem(const sptr<ApnItem> &newApnItem, const sptr<ApnItem> &oldApnItem,
         bool roamingState);
     void SetApnBadState(bool isBad);
+    void SetApnStateAggregate(const std::shared_ptr<ApnStateAggregate> &stateAggregate);
 
 private:
     ApnHolder(ApnHolder &apnHolder) = delete;
@@ -71,6 +73,7 @@ private:
     uint64_t capability_ = 0;
     ConnectionRetryPolicy retryPolicy_;
     ApnProfileState apnState_ = ApnProfileState::PROFILE_STATE_IDLE;
+    std::shared_ptr<ApnStateAggregate> stateAggregate_;
     sptr<ApnItem> apnItem_;
     std::string apnType_;
     int32_t priority_;
@@ -16,6 +16,8 @@
 #ifndef APN_ITEM_H
 #define APN_ITEM_H
 
+#include <atomic>
+#include <memory>
 #include <string>
 
 #include "cellular_data_constant.h"
@@ -23,25 +25,67 @@
 namespace OHOS {
 namespace Telephony {
 struct PdpProfile;
-struct ApnActivateInfo {
-    uint64_t actSuccTime;
-    uint32_t duration;
-    uint32_t reason;
-    uint32_t apnId;
-};
-
 struct ApnActivateReportInfo {
     uint32_t actTimes;
     uint32_t averDuration;
     uint32_t topReason;
     uint32_t actSuccTimes;
 };
+/**
+ * Immutable heap string of an APN attribute, copies of an APN item share it and it is freed with the last one.
+ */
+class ApnString {
+public:
+    ApnString() = default;
+    ApnString(const char *value);
+    ApnString(const std::string &value);
+    operator const char *() const
+    {
+        return c_str();
+    }
+    const char *c_str() const
+    {
+        return (value_ == nullptr) ? "" : value_->c_str();
+    }
+    size_t size() const
+    {
+        return (value_ == nullptr) ? 0 : value_->size();
+    }
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+protected:
+    explicit ApnString(std::shared_ptr<const std::string> value) : value_(std::move(value)) {}
+
+private:
+    std::shared_ptr<const std::string> value_ = nullptr;
+};
+
+/**
+ * ApnString of a low cardinality attribute (apn types, numeric, protocols) shared by all APN items through
+ * a process wide table. The table only holds weak references, so a value is freed once no item uses it.
+ */
+class InternedApnString : public ApnString {
+public:
+    InternedApnString() = default;
+    InternedApnString(const char *value);
+    InternedApnString(const std::string &value);
+    static size_t GetInternedCount();
+
+private:
+    static std::shared_ptr<const std::string> Intern(const std::string &value);
+};
+
 class ApnItem : public RefBase {
 public:
     ApnItem();
     ~ApnItem();
     std::vector<std::string> GetApnTypes() const;
     bool CanDealWithType(const std::string &type) const;
+    bool CanDealWithTypeMask(uint64_t typeMask) const;
+    uint64_t GetApnTypeMask() const;
     void MarkBadApn(bool badApn);
     bool IsBadApn() const;
     static sptr<ApnItem> MakeDefaultApn(const std::string &apnType);
@@ -51,10 +95,13 @@ public:
     {
         return (newProp == oldProp) || (newProp.empty()) || (oldProp.empty());
     }
+    static std::string GetMemoryDump();
 
 private:
     static sptr<ApnItem> BuildOtherApnAttributes(sptr<ApnItem> &apnItem, const PdpProfile &apnData);
     static bool IsSimilarProtocol(const std::string &newProtocol, const std::string &oldProtocol);
+    static bool IsAttributeLengthValid(const PdpProfile &apnData);
+    static uint64_t MakeApnTypeMask(const std::vector<std::string> &apnTypes);
 
 public:
     constexpr static int ALL_APN_ITEM_CHAR_LENGTH = 256;
@@ -80,10 +127,41 @@ public:
         char dnn_[ALL_APN_ITEM_CHAR_LENGTH] = { 0 };
         int32_t PduSessionType_ = 0;
         uint8_t RouteBitmap_ = 0;
+    };
+
+    /**
+     * In-memory layout of Attribute, the fixed layout is only produced by ToAttribute at the IPC boundary.
+     */
+    struct CompactAttribute {
+        InternedApnString types_;
+        InternedApnString numeric_;
+        int32_t profileId_ = 0;
+        InternedApnString protocol_;
+        InternedApnString roamingProtocol_;
+        int32_t authType_ = 0;
+        ApnString apn_;
+        ApnString apnName_;
+        ApnString user_;
+        ApnString password_;
+        bool isRoamingApn_ = false;
+        ApnString homeUrl_;
+        ApnString proxyIpAddress_;
+        ApnString mmsIpAddress_;
+        bool isEdited_ = false;
+        /* For networkslice*/
+        ApnString snssai_;
+        uint8_t sscMode_ = 0;
+        ApnString dnn_;
+        int32_t PduSessionType_ = 0;
+        uint8_t RouteBitmap_ = 0;
+
+        void ToAttribute(Attribute &attr) const;
     } attr_;
 
 private:
+    static std::atomic<uint32_t> liveItemCount_;
     std::vector<std::string> apnTypes_;
+    uint64_t apnTypeMask_ = 0;
     bool badApn_ = false;
 };
 } // namespace Telephony
@@ -57,19 +57,25 @@ private:
     int32_t MakeSpecificApnItem(std::vector<PdpProfile> &apnVec, int32_t slotId);
     void GetCTOperator(int32_t slotId, std::string &numeric);
     void TryMergeSimilarPdpProfile(std::vector<PdpProfile> &apnVec);
+    static size_t HashPdpProfileKey(const PdpProfile &profile);
     void MergePdpProfile(PdpProfile &newProfile, PdpProfile &oldProfile);
     bool GetPreferId(int32_t slotId, std::string &errMsg);
     int32_t PushApnItem(int32_t count, int32_t slotId, sptr<ApnItem> extraApnItem);
+    void BuildApnTypeIndex();
+    bool LoadApnStateWord(uint64_t &stateWord) const;
+    static ApnProfileState GetOverallApnStateFromWord(uint64_t stateWord);
 
 private:
     static const std::map<std::string, int32_t> apnIdApnNameMap_;
     static const std::map<std::string, ApnTypes> apnNameApnTypeMap_;
     static const std::vector<ApnProfileState> apnStateArr_;
     std::vector<sptr<ApnItem>> allApnItem_;
+    std::map<uint64_t, std::vector<sptr<ApnItem>>> apnTypeIndex_;
     std::vector<sptr<ApnHolder>> apnHolders_;
     std::map<int32_t, sptr<ApnHolder>> apnIdApnHolderMap_;
     std::vector<sptr<ApnHolder>> sortedApnHolders_;
     std::shared_mutex mutex_;
+    std::shared_ptr<ApnStateAggregate> apnStateAggregate_ = std::make_shared<ApnStateAggregate>();
     int32_t preferId_ = -1;
 };
 } // namespace Telephony
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef APN_STATE_AGGREGATE_H
+#define APN_STATE_AGGREGATE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "cellular_data_constant.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Aggregate of all apn holder states packed into one word, so readers on IPC threads
+ * get a consistent view with a single atomic load.
+ * bits 0-29: holder count per ApnProfileState, 5 bits each
+ * bits 30-32: state of the default holder, bits 33-35: state of the internal_default holder
+ * bits 36-63: epoch, increased on every transition
+ */
+class ApnStateAggregate {
+public:
+    ApnStateAggregate() = default;
+    ~ApnStateAggregate() = default;
+    void AddHolder(const std::string &apnType, ApnProfileState state);
+    void OnStateChanged(const std::string &apnType, ApnProfileState oldState, ApnProfileState newState);
+    uint64_t Load() const;
+    static uint32_t GetStateCount(uint64_t stateWord, ApnProfileState state);
+    static uint32_t GetHolderCount(uint64_t stateWord);
+    static ApnProfileState GetDefaultState(uint64_t stateWord);
+    static ApnProfileState GetInternalDefaultState(uint64_t stateWord);
+    static uint32_t GetEpoch(uint64_t stateWord);
+
+private:
+    static uint64_t UpdateCount(uint64_t stateWord, ApnProfileState state, bool increase);
+    static uint64_t UpdateRoleState(uint64_t stateWord, const std::string &apnType, ApnProfileState state);
+    static uint64_t IncreaseEpoch(uint64_t stateWord);
+
+private:
+    std::atomic<uint64_t> stateWord_ { 0 };
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // APN_STATE_AGGREGATE_H
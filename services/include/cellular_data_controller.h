@@ -55,6 +55,7 @@ public:
     bool IsSupportDunApn();
     bool GetDefaultActReportInfo(ApnActivateReportInfo &info);
     bool GetInternalActReportInfo(ApnActivateReportInfo &info);
+    std::string GetPendingIntentDump() const;
 
 private:
     void RegisterEvents();
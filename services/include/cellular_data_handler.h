@@ -16,6 +16,9 @@
 #ifndef CELLULAR_DATA_HANDLER_H
 #define CELLULAR_DATA_HANDLER_H
 
+#include <set>
+
+#include "apn_activate_stats.h"
 #include "cellular_data_incall_observer.h"
 #include "cellular_data_rdb_observer.h"
 #include "cellular_data_roaming_observer.h"
@@ -24,6 +27,8 @@
 #include "cellular_data_state_machine.h"
 #include "data_switch_settings.h"
 #include "incall_data_state_machine.h"
+#include "pending_intent_table.h"
+#include "radio_context_snapshot.h"
 #include "radio_event.h"
 #include "state_notification.h"
 #include "telephony_types.h"
@@ -32,6 +37,8 @@
 namespace OHOS {
 namespace Telephony {
 const uint32_t KEEP_APN_ACTIVATE_PERIOD = 30 * 1000;
+// typical concurrent PDNs of one slot: default, ims, internal_default, mms and xcap
+const size_t CONNECTION_POOL_SIZE = 5;
 #ifdef BASE_POWER_IMPROVEMENT
 class CellularDataPowerSaveModeSubscriber;
 #endif
@@ -60,6 +67,7 @@ public:
     void EstablishAllApnsIfConnectable();
     void ClearAllConnections(DisConnectionReason reason);
     void ClearConnectionsOnUpdateApns(DisConnectionReason reason);
+    void ClearChangedConnectionsOnUpdateApns(DisConnectionReason reason);
     bool ChangeConnectionForDsds(bool enable);
     int32_t GetSlotId() const;
     bool HandleApnChanged();
@@ -67,6 +75,8 @@ public:
     int32_t GetCellularDataFlowType();
     void SetPolicyDataOn(bool enable);
     bool IsRestrictedMode() const;
+    std::shared_ptr<const RadioContextSnapshot> GetRadioContext() const;
+    void RefreshRadioContext();
     DisConnectionReason GetDisConnectionReason();
     bool HasInternetCapability(const int32_t cid) const;
     void GetDataConnApnAttr(ApnItem::Attribute &apnAttr) const;
@@ -90,6 +100,8 @@ public:
 
     ApnActivateReportInfo GetDefaultActReportInfo();
     ApnActivateReportInfo GetInternalActReportInfo();
+    std::string GetPendingIntentDump() const;
+    void DrainConnectionPool();
 #ifdef BASE_POWER_IMPROVEMENT
     std::shared_ptr<CellularDataPowerSaveModeSubscriber> strEnterSubscriber_ = nullptr;
     std::shared_ptr<CellularDataPowerSaveModeSubscriber> strExitSubscriber_ = nullptr;
@@ -98,6 +110,8 @@ public:
 private:
     std::shared_ptr<CellularDataStateMachine> CreateCellularDataConnect();
     std::shared_ptr<CellularDataStateMachine> FindIdleCellularDataConnection() const;
+    std::shared_ptr<CellularDataStateMachine> AcquireCellularDataConnect();
+    void WarmUpConnectionPool();
     bool CheckCellularDataSlotId(sptr<ApnHolder> &apnHolder);
     bool CheckAttachAndSimState(sptr<ApnHolder> &apnHolder);
     bool CheckRoamingState(sptr<ApnHolder> &apnHolder);
@@ -107,6 +121,7 @@ private:
     void AttemptEstablishDataConnection(sptr<ApnHolder> &apnHolder);
     bool EstablishDataConnection(sptr<ApnHolder> &apnHolder, int32_t radioTech);
     void RadioPsConnectionAttached(const AppExecFwk::InnerEvent::Pointer &event);
+    void RadioPsConnectionDetached(const AppExecFwk::InnerEvent::Pointer &event);
     void RoamingStateOn(const AppExecFwk::InnerEvent::Pointer &event);
     void RoamingStateOff(const AppExecFwk::InnerEvent::Pointer &event);
     void PsRadioEmergencyStateOpen(const AppExecFwk::InnerEvent::Pointer &event);
@@ -142,6 +157,10 @@ private:
     void HandleDBSettingEnableChanged(const AppExecFwk::InnerEvent::Pointer &event);
     void HandleDBSettingRoamingChanged(const AppExecFwk::InnerEvent::Pointer &event);
     void HandleSortConnection();
+    void EstablishWaitingConnections(const sptr<ApnHolder> &connectedApnHolder);
+    void EstablishBlockedConnections();
+    bool IsReadyToEstablish(const sptr<ApnHolder> &apnHolder) const;
+    void RecordPdnBringUpIfDone();
     void SetDataPermittedResponse(const AppExecFwk::InnerEvent::Pointer &event);
     void SetDataPermitted(int32_t slotId, bool dataPermitted);
     bool CheckDataPermittedByDsds();
@@ -170,6 +189,7 @@ private:
     bool IsCdma();
     void HandleScreenStateChanged(bool isScreenOn) const;
     void HandleEstablishAllApnsIfConnectable(const AppExecFwk::InnerEvent::Pointer &event);
+    void HandleWarmUpConnectionPool(const AppExecFwk::InnerEvent::Pointer &event);
     void HandleMccChangeDelay(const AppExecFwk::InnerEvent::Pointer &event);
 #ifdef OHOS_BUILD_ENABLE_TELEPHONY_EXT
     bool IsSimRequestNetOnVSimEnabled(int32_t reqType, bool isMmsType) const;
@@ -179,7 +199,10 @@ private:
 #endif
     void SetNetRequest(NetRequest &request, const std::unique_ptr<NetRequest> &netRequest);
     void SendEstablishDataConnectionEvent(int32_t id, uint64_t disconnectBearType);
+    bool SendEstablishEvent(int32_t apnId, int64_t delayTime);
     bool IsSimStateReadyOrLoaded();
+    bool IsRadioContextEvent(uint32_t eventCode) const;
+    void DispatchEvent(uint32_t eventCode, const AppExecFwk::InnerEvent::Pointer &event);
     void UpdateCellularDataConnectState(const std::string &apnType);
     void RetryToSetupDatacall(const AppExecFwk::InnerEvent::Pointer &event);
     void RetryOrClearConnection(const sptr<ApnHolder> &apnHolder, DisConnectionReason reason,
@@ -197,7 +220,6 @@ private:
     int64_t GetCurTime();
     void SetApnActivateStart(const std::string &apnType);
     void SetApnActivateEnd(const std::shared_ptr<SetupDataCallResultInfo> &resultInfo);
-    void EraseApnActivateList();
     ApnActivateReportInfo GetApnActReportInfo(uint32_t apnId);
     bool IsBlockSetRilAttachApn();
 
@@ -227,9 +249,13 @@ private:
     bool isSimAccountLoaded_ = false;
     bool isHandoverOccurred_ = false;
     bool isMccChanged_ = false;
+    bool pdnBringUpPending_ = false;
+    std::chrono::steady_clock::time_point pdnBringUpBeginTime_;
+    std::set<int32_t> waitingApnIds_;
     std::mutex mtx_;
-    std::mutex apnActivateListMutex_;
     std::mutex initMutex_;
+    mutable std::mutex radioContextMutex_;
+    mutable std::shared_ptr<const RadioContextSnapshot> radioContext_ = nullptr;
     std::vector<std::string> upLinkThresholds_;
     std::vector<std::string> downLinkThresholds_;
     sptr<CellularDataSettingObserver> settingObserver_;
@@ -239,90 +265,15 @@ private:
     sptr<CellularDataAirplaneObserver> airplaneObserver_;
     std::shared_ptr<IncallDataStateMachine> incallDataStateMachine_;
     sptr<ApnItem> lastApnItem_ = nullptr;
-    std::vector<ApnActivateInfo> apnActivateChrList_;
+    ApnActivateStats defaultApnActStats_ { KEEP_APN_ACTIVATE_PERIOD };
+    ApnActivateStats internalApnActStats_ { KEEP_APN_ACTIVATE_PERIOD };
+    PendingIntentTable pendingIntents_;
+    std::mutex connectionPoolMutex_;
+    std::vector<std::shared_ptr<CellularDataStateMachine>> connectionPool_;
     uint64_t defaultApnActTime_ = 0;
     uint64_t internalApnActTime_ = 0;
     int32_t retryCreateApnTimes_ = 0;
 
-    using Fun = std::function<void(const AppExecFwk::InnerEvent::Pointer &event)>;
-    std::map<uint32_t, Fun> eventIdMap_ {
-        { RadioEvent::RADIO_PS_CONNECTION_ATTACHED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { RadioPsConnectionAttached(event); } },
-        { RadioEvent::RADIO_PS_ROAMING_OPEN,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { RoamingStateOn(event); } },
-        { RadioEvent::RADIO_PS_ROAMING_CLOSE,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { RoamingStateOff(event); } },
-        { RadioEvent::RADIO_EMERGENCY_STATE_OPEN,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { PsRadioEmergencyStateOpen(event); } },
-        { RadioEvent::RADIO_EMERGENCY_STATE_CLOSE,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { PsRadioEmergencyStateClose(event); } },
-        { CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION_COMPLETE,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { EstablishDataConnectionComplete(event); } },
-        { CellularDataEventCode::MSG_DISCONNECT_DATA_COMPLETE,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { DisconnectDataComplete(event); } },
-        { CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { MsgEstablishDataConnection(event); } },
-        { CellularDataEventCode::MSG_SETTING_SWITCH,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleSettingSwitchChanged(event); } },
-        { CellularDataEventCode::MSG_REQUEST_NETWORK,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { MsgRequestNetwork(event); } },
-        { RadioEvent::RADIO_STATE_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleRadioStateChanged(event); } },
-        { RadioEvent::RADIO_DSDS_MODE_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleDsdsModeChanged(event); } },
-        { RadioEvent::RADIO_SIM_STATE_CHANGE,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleSimEvent(event); } },
-        { RadioEvent::RADIO_SIM_RECORDS_LOADED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleSimEvent(event); } },
-        { RadioEvent::RADIO_SIM_ACCOUNT_LOADED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleSimEvent(event); } },
-        { RadioEvent::RADIO_PS_RAT_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { PsDataRatChanged(event); } },
-        { CellularDataEventCode::MSG_APN_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleApnChanged(event); } },
-        { CellularDataEventCode::MSG_SET_RIL_ATTACH_APN,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { SetRilAttachApnResponse(event); } },
-        { RadioEvent::RADIO_NR_STATE_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleRadioNrStateChanged(event); } },
-        { RadioEvent::RADIO_NR_FREQUENCY_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleRadioNrFrequencyChanged(event); } },
-        { CellularDataEventCode::MSG_DB_SETTING_ENABLE_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleDBSettingEnableChanged(event); } },
-        { CellularDataEventCode::MSG_DB_SETTING_ROAMING_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleDBSettingRoamingChanged(event); } },
-        { CellularDataEventCode::MSG_DB_SETTING_INCALL_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleDBSettingIncallChanged(event); } },
-        { CellularDataEventCode::MSG_INCALL_DATA_COMPLETE,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { IncallDataComplete(event); } },
-        { RadioEvent::RADIO_RIL_ADAPTER_HOST_DIED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { OnRilAdapterHostDied(event); } },
-        { RadioEvent::RADIO_FACTORY_RESET,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleFactoryReset(event); } },
-        { RadioEvent::RADIO_CLEAN_ALL_DATA_CONNECTIONS,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { OnCleanAllDataConnectionsDone(event); } },
-        { CellularDataEventCode::MSG_DATA_CALL_LIST_CHANGED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleUpdateNetInfo(event); } },
-        { RadioEvent::RADIO_NV_REFRESH_FINISHED,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleSimEvent(event); } },
-        { CellularDataEventCode::MSG_RETRY_TO_SETUP_DATACALL,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { RetryToSetupDatacall(event); } },
-        { CellularDataEventCode::MSG_ESTABLISH_ALL_APNS_IF_CONNECTABLE,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleEstablishAllApnsIfConnectable(event); } },
-        { CellularDataEventCode::MSG_RESUME_DATA_PERMITTED_TIMEOUT,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { ResumeDataPermittedTimerOut(event); } },
-        { CellularDataEventCode::MSG_RETRY_TO_CREATE_APN,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleApnChanged(event); } },
-        { CellularDataEventCode::MSG_RETRY_TO_LOAD_SIM_ACCOUNT,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleRetryLoadSimAccount(event); } },
-        { RadioEvent::RADIO_RESIDENT_NETWORK_CHANGE,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleResidentNetworkChanged(event); } },
-        { CellularDataEventCode::MSG_MCC_CHANGE_ACTIVATE_DELAY,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleMccChangeDelay(event); } },
-#ifdef BASE_POWER_IMPROVEMENT
-        { CellularDataEventCode::MSG_TIMEOUT_TO_REPLY_COMMON_EVENT,
-            [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleReplyCommonEvent(event); } },
-#endif
-    };
 #ifdef BASE_POWER_IMPROVEMENT
     std::shared_ptr<CellularDataPowerSaveModeSubscriber> CreateCommonSubscriber(
         const std::string &event, int32_t priority);
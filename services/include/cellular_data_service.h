@@ -48,6 +48,8 @@ public:
     std::string GetCellularDataSlotIdDump();
     std::string GetStateMachineCurrentStatusDump();
     std::string GetFlowDataInfoDump();
+    std::string GetApnCacheDump();
+    std::string GetPendingIntentDump();
     int32_t IsCellularDataEnabled(bool &dataEnabled) override;
     int32_t EnableCellularData(bool enable) override;
     int32_t GetCellularDataState(int32_t &state) override;
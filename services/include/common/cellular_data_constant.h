@@ -269,6 +269,10 @@ static constexpr const char *CELLULAR_DATA_AIRPLANE_MODE_URI =
 static const int32_t DEFAULT_NET_STATISTICS_PERIOD = 3 * 1000;
 static const int32_t DATA_STALL_ALARM_NON_AGGRESSIVE_DELAY_IN_MS_DEFAULT = 1000 * 60 * 10;
 static const int32_t DATA_STALL_ALARM_AGGRESSIVE_DELAY_IN_MS_DEFAULT = 1000 * 10;
+static const int32_t DATA_STALL_ALARM_MIN_DELAY_IN_MS = 1000 * 2;
+static const int32_t DATA_STALL_ALARM_SCREEN_ON_MAX_DELAY_IN_MS = 1000 * 60;
+static const int32_t DATA_STALL_ALARM_SCREEN_OFF_MAX_DELAY_IN_MS = 1000 * 60 * 30;
+static const int32_t DATA_STALL_ALARM_MAX_BACKOFF_SHIFT = 6;
 static const int32_t ESTABLISH_DATA_CONNECTION_DELAY = 1 * 1000;
 static const int32_t CONNECTION_TIMEOUT = 180 * 1000;
 static const int32_t DISCONNECTION_TIMEOUT = 90 * 1000;
@@ -292,6 +296,9 @@ static constexpr const char *CONFIG_PREFERAPN = "persist.sys.data.preferapn";
 static constexpr const char *CONFIG_MOBILE_MTU = "persist.sys.data.mobilemtu";
 static constexpr const char *CONFIG_DATA_SERVICE_EXT_PATH = "persist.sys.data.dataextpath";
 static constexpr const char *CONFIG_MULTIPLE_CONNECTIONS = "persist.sys.data.multiple.connections";
+static constexpr const char *CONFIG_STALL_WINDOW_SIZE = "persist.sys.data.stall.window";
+static constexpr const char *CONFIG_STALL_MIN_TX_PACKETS = "persist.sys.data.stall.mintxpackets";
+static constexpr const char *CONFIG_STALL_CONFIDENCE = "persist.sys.data.stall.confidence";
 static constexpr const char *PERSIST_TSTS_MODE = "persist.telephony.tsts_mode";
 static constexpr const char *TSTS_MODE_DEFAULT_VALUE = "0";
 static constexpr int32_t SYS_PARAMETER_SIZE = 128;
@@ -340,6 +347,7 @@ static const int UP_DOWN_LINK_SIZE = 100;
 static const int32_t VALID_VECTOR_SIZE = 2;
 static const int32_t DELAY_SET_RIL_BANDWIDTH_MS = 3000;
 static const int32_t DELAY_SET_RIL_UP_DOWN_BANDWIDTH_MS = 50;
+static const int32_t DATA_CALL_LIST_COALESCE_WINDOW_MS = 200;
 static const int32_t MAX_REPLY_COUNT = 200;
 static constexpr const char *CELLULAR_DATA_COLUMN_ENABLE = "cellular_data_enable";
 static constexpr const char *SIM_DETECTED_COLUMN_ENABLE = "any_sim_detected";
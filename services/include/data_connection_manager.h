@@ -19,6 +19,8 @@
 #include <tel_ril_data_parcel.h>
 
 #include "data_connection_monitor.h"
+#include "link_config_table.h"
+#include "radio_context_snapshot.h"
 #include "state_machine.h"
 
 namespace OHOS {
@@ -55,9 +57,12 @@ public:
     int32_t GetDataRecoveryState();
     void IsNeedDoRecovery(bool needDoRecovery) const;
     void HandleScreenStateChanged(bool isScreenOn) const;
+    void SetRadioContext(const std::shared_ptr<const RadioContextSnapshot> &radioContext);
 
 private:
     void UpdateBandWidthsUseLte();
+    void PublishLinkConfigTable();
+    void GetNrContext(NrState &nrState, FrequencyType &frequencyType);
 
 private:
     std::shared_ptr<DataConnectionMonitor> connectionMonitor_;
@@ -67,10 +72,14 @@ private:
     std::mutex activeConnectionMutex_;
     std::mutex tcpBufferConfigMutex_;
     std::mutex bandwidthConfigMutex_;
+    std::mutex radioContextMutex_;
+    std::shared_ptr<const RadioContextSnapshot> radioContext_ = nullptr;
     std::shared_ptr<State> ccmDefaultState_ = nullptr;
     const int32_t slotId_;
     std::map<std::string, LinkBandwidthInfo> bandwidthConfigMap_;
     std::map<std::string, std::string> tcpBufferConfigMap_;
+    // parsed from the two maps above, read without locking on the link update path
+    std::shared_ptr<const LinkConfigTable> linkConfigTable_ = nullptr;
     bool bandwidthSourceModem_ = true;
     bool uplinkUseLte_ = false;
 };
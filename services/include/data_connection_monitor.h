@@ -17,6 +17,7 @@
 #define DATA_CONNECTION_MONITOR_H
 
 #include "apn_holder.h"
+#include "stall_detector.h"
 #include "tel_event_handler.h"
 #include "traffic_management.h"
 
@@ -114,13 +115,16 @@ private:
     int32_t GetStallDetectionPeriod();
     bool IsScreenOn();
     bool IsVsimEnabled();
+    void LoadStallDetectorConfig();
 
     std::unique_ptr<TrafficManagement> trafficManager_;
     std::unique_ptr<TrafficManagement> stallDetectionTrafficManager_;
     bool updateNetStat_ = false;
     bool stallDetectionEnabled_ = false;
     bool isScreenOn_ = false;
-    int64_t noRecvPackets_ = 0;
+    int32_t idleRounds_ = 0;
+    int32_t stallRounds_ = 0;
+    StallDetector stallDetector_;
     RecoveryState dataRecoveryState_ = RecoveryState::STATE_REQUEST_CONTEXT_LIST;
     CellDataFlowType dataFlowType_ = CellDataFlowType::DATA_FLOW_TYPE_NONE;
     const int32_t slotId_;
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PENDING_INTENT_TABLE_H
+#define PENDING_INTENT_TABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Per apn id table of MSG_REQUEST_NETWORK and MSG_ESTABLISH_DATA_CONNECTION events that are queued
+ * but not handled yet. A new event that the queued ones already cover is dropped before it is sent.
+ */
+class PendingIntentTable {
+public:
+    PendingIntentTable() = default;
+    ~PendingIntentTable() = default;
+
+    /**
+     * Register a network request or release before it is sent
+     *
+     * @param apnId apn id of the request capability
+     * @param ident request ident
+     * @param type TYPE_REQUEST_NET or TYPE_RELEASE_NET
+     * @param bearTypes request bear types
+     * @return false if an equal queued request already covers it and it need not be sent
+     */
+    bool AddNetRequest(int32_t apnId, const std::string &ident, int32_t type, uint64_t bearTypes);
+    void FinishNetRequest(int32_t apnId, const std::string &ident, int32_t type);
+
+    /**
+     * Register an establish data connection event before it is sent
+     *
+     * @param apnId apn id of the event
+     * @param delayTime delay of the event in milliseconds
+     * @param force register without coalescing, for events carrying extra data
+     * @return false if a queued event of the apn id is handled no later than this one
+     */
+    bool AddEstablish(int32_t apnId, int64_t delayTime, bool force = false);
+    void FinishEstablish(int32_t apnId);
+
+    void AddCoalescedCount();
+    void AddExecutedCount();
+    uint64_t GetCoalescedCount() const;
+    uint64_t GetExecutedCount() const;
+    void Clear();
+
+private:
+    struct NetRequestIntent {
+        std::string ident;
+        int32_t type = 0;
+        uint64_t bearTypes = 0;
+        int64_t sendTime = 0;
+    };
+
+    static int64_t GetSteadyTimeMs();
+
+private:
+    std::mutex mutex_;
+    std::map<int32_t, std::deque<NetRequestIntent>> netRequests_;
+    std::map<int32_t, std::multiset<int64_t>> establishDueTimes_;
+    std::atomic<uint64_t> coalescedCount_ { 0 };
+    std::atomic<uint64_t> executedCount_ { 0 };
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // PENDING_INTENT_TABLE_H
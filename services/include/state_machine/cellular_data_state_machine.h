@@ -16,6 +16,8 @@
 #ifndef CELLULAR_DATA_STATE_MACHINE_H
 #define CELLULAR_DATA_STATE_MACHINE_H
 
+#include <chrono>
+
 #include "cellular_data_net_agent.h"
 #include "data_connection_manager.h"
 #include "data_connection_params.h"
@@ -74,6 +76,7 @@ public:
     void SetConnectionTcpBuffer(const std::string &tcpBuffer);
     void SplitProxyIpAddress(const std::string &proxyIpAddress, std::string &host, uint16_t &port);
     void UpdateNetworkInfoIfInActive(SetupDataCallResultInfo &info);
+    std::shared_ptr<SetupDataCallResultInfo> TakePendingNetworkInfo();
     void UpdateReuseApnNetworkInfo(bool isAvailable);
     void SetReuseApnCap(uint64_t cap);
     uint64_t GetReuseApnCap() const;
@@ -131,6 +134,11 @@ private:
     std::string ifName_ = "";
     sptr<OHOS::NetManagerStandard::INetInterfaceStateCallback> netInterfaceCallback_ = nullptr;
     uint64_t reuseApnCap_ = NetManagerStandard::NetCap::NET_CAPABILITY_END;
+    std::mutex pendingNetInfoMutex_;
+    // latest data call info not yet applied by the handler
+    std::shared_ptr<SetupDataCallResultInfo> pendingNetInfo_ = nullptr;
+    std::chrono::steady_clock::time_point coalesceWindowEnd_;
+    bool trailingScheduled_ = false;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -17,6 +17,7 @@
 #define STATE_MACHINE_H
 
 #include "cellular_data_event_code.h"
+#include "cellular_data_perf_stats.h"
 #include "tel_event_handler.h"
 
 namespace OHOS {
@@ -58,6 +59,11 @@ public:
         originalState_ = originalState;
     }
 
+    void SetSlotId(int32_t slotId)
+    {
+        slotId_ = slotId;
+    }
+
     virtual void TransitionTo(std::shared_ptr<State> &destState)
     {
         TELEPHONY_LOGI("State machine transition to %{public}s", destState->name_.c_str());
@@ -112,6 +118,7 @@ public:
             TELEPHONY_LOGE("The event parameter is incorrect");
             return;
         }
+        CellularDataPerfScope perfScope(PerfComponent::STATE_MACHINE, slotId_, event);
         if (event->GetInnerEventId() == CellularDataEventCode::MSG_STATE_MACHINE_QUIT) {
             TELEPHONY_LOGI("State machine exit");
             Quit();
@@ -169,6 +176,7 @@ private:
     std::vector<AppExecFwk::InnerEvent::Pointer> deferEvents_;
     std::mutex mtx_;
     bool isQuit_ = false;
+    int32_t slotId_ = -1;
 };
 
 class StateMachine {
@@ -219,6 +227,15 @@ public:
         stateMachineEventHandler_->SetOriginalState(originalState);
     }
 
+    void SetSlotId(int32_t slotId)
+    {
+        if (stateMachineEventHandler_ == nullptr) {
+            TELEPHONY_LOGE("stateMachineEventHandler_ is null");
+            return;
+        }
+        stateMachineEventHandler_->SetSlotId(slotId);
+    }
+
     void TransitionTo(std::shared_ptr<State> &destState)
     {
         if (destState == nullptr) {
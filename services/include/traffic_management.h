@@ -38,13 +38,22 @@ public:
      */
     void UpdatePacketData();
 
+    /**
+     * Set the root directory of the per-interface statistics nodes
+     *
+     * @param rootPath directory containing <iface>/statistics, default is /sys/class/net/
+     */
+    void SetIfaceStatsRootPath(const std::string &rootPath);
+
 private:
     std::string GetIfaceName();
+    bool ReadIfaceStats(const std::string &ifaceName, const std::string &node, int64_t &value) const;
 
 private:
     int64_t sendPackets_ = 0;
     int64_t recvPackets_ = 0;
     const int32_t slotId_;
+    std::string ifaceStatsRootPath_;
 };
 } // namespace Telephony
 } // namespace OHOS
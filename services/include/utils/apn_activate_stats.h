@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef APN_ACTIVATE_STATS_H
+#define APN_ACTIVATE_STATS_H
+
+#include <cstdint>
+#include <mutex>
+
+#include "apn_item.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Activation statistics of one apn over a sliding time window.
+ * The window is split into a fixed ring of time buckets, expired buckets are subtracted from running sums,
+ * so adding a result and building the report do not depend on how many activations happened.
+ */
+class ApnActivateStats {
+public:
+    explicit ApnActivateStats(int64_t windowMs);
+    ~ApnActivateStats() = default;
+
+    /**
+     * Add one activation result
+     *
+     * @param nowMs current time in milliseconds
+     * @param duration activation duration in milliseconds
+     * @param reason fail reason, 0 if activated successfully
+     */
+    void Add(int64_t nowMs, uint32_t duration, uint32_t reason);
+
+    /**
+     * Get the statistics of the activations inside the window
+     *
+     * @param nowMs current time in milliseconds
+     * @return activate times, success times, average duration and the most frequent fail reason
+     */
+    ApnActivateReportInfo GetReportInfo(int64_t nowMs);
+
+private:
+    static constexpr uint32_t BUCKET_COUNT = 10;
+    static constexpr uint32_t TOP_REASON_COUNT = 4;
+
+    struct ReasonCount {
+        uint32_t reason = 0;
+        uint32_t count = 0;
+    };
+
+    struct TimeBucket {
+        int64_t epoch = -1;
+        uint64_t duration = 0;
+        uint32_t actTimes = 0;
+        uint32_t actSuccTimes = 0;
+        ReasonCount reasons[TOP_REASON_COUNT];
+    };
+
+    void ExpireBuckets(int64_t epoch);
+    void ResetBucket(TimeBucket &bucket);
+    static void AddReason(TimeBucket &bucket, uint32_t reason);
+
+private:
+    int64_t bucketWidthMs_;
+    TimeBucket buckets_[BUCKET_COUNT];
+    uint64_t totalDuration_ = 0;
+    uint32_t totalActTimes_ = 0;
+    uint32_t totalActSuccTimes_ = 0;
+    std::mutex mutex_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // APN_ACTIVATE_STATS_H
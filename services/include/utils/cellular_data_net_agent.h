@@ -16,7 +16,14 @@
 #ifndef CELLULAR_DATA_NET_AGENT_H
 #define CELLULAR_DATA_NET_AGENT_H
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #include "i_net_conn_service.h"
 
@@ -59,7 +66,7 @@ public:
     void UnregisterPolicyCallback();
 
     /**
-     * Update network information
+     * Update network information, skipped when it is identical to the last information pushed for the supplier
      *
      * @param supplierId network unique identity id returned after network registration
      * @param netSupplierInfo network data information
@@ -67,7 +74,7 @@ public:
     int32_t UpdateNetSupplierInfo(uint32_t supplierId, sptr<NetManagerStandard::NetSupplierInfo> &netSupplierInfo);
 
     /**
-     * Update link information
+     * Update link information, skipped when it is identical to the last information pushed for the supplier
      *
      * @param supplierId network unique identity id returned after network registration
      * @param netLinkInfo network link data information
@@ -108,13 +115,102 @@ public:
     bool GetSupplierRegState(uint32_t supplierId, int32_t &regState);
 
     int32_t GetSlotId(int32_t simId);
+
+    /**
+     * Get the net id of the cellular network of the slot, cached from the first query after the link is
+     * reported through UpdateNetLinkInfo until the slot disconnects or its suppliers are unregistered
+     *
+     * @param slotId card slot identification
+     * @return net id, -1 if there is no cellular network
+     */
     int32_t GetCellNetId(int32_t slotId);
+    std::string GetCellNetIdCacheDump();
+    std::string GetNetInfoPushDump();
     void NetDetection(int32_t netId);
 
+    /**
+     * Cache the interface name of the active internet connection, empty string clears it
+     *
+     * @param slotId card slot identification
+     * @param ifaceName interface name reported by the modem
+     */
+    void SetCellIfaceName(int32_t slotId, const std::string &ifaceName);
+    std::string GetCellIfaceName(int32_t slotId);
+
+private:
+    /**
+     * Read-only copy of netSuppliers_ with its lookup tables, replaced as a whole on every change
+     * so the readers on the link update and callback paths never wait for a registration
+     */
+    struct SupplierIndex {
+        std::vector<NetSupplier> suppliers;
+        std::unordered_map<uint64_t, size_t> slotCapabilityIndex;
+        std::unordered_map<uint32_t, size_t> supplierIdIndex;
+    };
+
+    std::vector<NetSupplier> CollectSlotSuppliers(int32_t slotId);
+    void RegisterSuppliersToNetManager(int32_t slotId, std::vector<NetSupplier> &suppliers);
+    void PublishSuppliers(const std::vector<NetSupplier> &suppliers);
+    void PublishSupplierIndex();
+    void SetSlotSimId(int32_t slotId, int32_t simId);
+    void RemoveSlotSimId(int32_t slotId);
+    void PublishSimIdIndex();
+    static uint64_t MakeSupplierKey(int32_t slotId, uint64_t capability);
+    int32_t QueryCellNetId(int32_t slotId);
+    int32_t FindSupplierSlotId(uint32_t supplierId);
+    void ArmCellNetIdCache(int32_t slotId);
+    uint64_t GetCellNetIdGeneration(int32_t slotId) const;
+    void InvalidateCellNetIdCache(int32_t slotId);
+    void InvalidateAllCellNetIdCache();
+    struct PushedSupplierInfo {
+        bool isAvailable = false;
+        bool isRoaming = false;
+        int64_t linkUpBandwidthKbps = 0;
+        int64_t linkDownBandwidthKbps = 0;
+        int64_t score = 0;
+        bool operator==(const PushedSupplierInfo &other) const;
+    };
+    struct PushedLinkInfo {
+        std::string ifaceName;
+        int64_t mtu = 0;
+        std::string tcpBufferSizes;
+        std::string proxyHost;
+        int64_t proxyPort = 0;
+        std::vector<std::pair<std::string, int32_t>> netAddrs;
+        std::vector<std::string> dnsAddrs;
+        // iface, destination, gateway
+        std::vector<std::tuple<std::string, std::string, std::string>> routes;
+        bool operator==(const PushedLinkInfo &other) const;
+    };
+    template<typename T>
+    bool IsPushedNetInfo(const std::map<uint32_t, T> &pushed, uint32_t supplierId, const T &info);
+    void ForgetPushedNetInfo(uint32_t supplierId);
+    static PushedSupplierInfo MakePushedSupplierInfo(const NetManagerStandard::NetSupplierInfo &netSupplierInfo);
+    static PushedLinkInfo MakePushedLinkInfo(const NetManagerStandard::NetLinkInfo &netLinkInfo);
+
 private:
+    std::mutex registerMutex_;
     std::shared_mutex netSupplierMutex_;
+    std::shared_ptr<const SupplierIndex> supplierIndex_;
     std::shared_mutex slotIdSimIdMutex_;
     std::map <int32_t, int32_t> slotIdSimId_;
+    std::shared_ptr<const std::unordered_map<int32_t, int32_t>> simIdSlotId_;
+    std::shared_mutex cellIfaceNameMutex_;
+    std::map<int32_t, std::string> cellIfaceName_;
+    std::shared_mutex cellNetIdMutex_;
+    // slots with a reported link, -1 until the net id is resolved
+    std::map<int32_t, int32_t> cellNetId_;
+    // bumped whenever a slot is armed or dropped, a query only writes back if it did not change meanwhile
+    std::map<int32_t, uint64_t> cellNetIdGeneration_;
+    std::atomic<uint64_t> netIdCacheHits_ { 0 };
+    std::atomic<uint64_t> netIdCacheMisses_ { 0 };
+    std::atomic<uint64_t> netIdCacheInvalidations_ { 0 };
+    std::mutex pushedNetInfoMutex_;
+    // fields of the last information accepted by the net manager for each supplier id
+    std::map<uint32_t, PushedSupplierInfo> pushedSupplierInfo_;
+    std::map<uint32_t, PushedLinkInfo> pushedLinkInfo_;
+    std::atomic<uint64_t> netInfoPushes_ { 0 };
+    std::atomic<uint64_t> suppressedNetInfoPushes_ { 0 };
     std::vector<NetSupplier> netSuppliers_;
     sptr<NetManagerCallBack> callBack_;
     sptr<NetManagerTacticsCallBack> tacticsCallBack_;
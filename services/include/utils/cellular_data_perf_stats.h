@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CELLULAR_DATA_PERF_STATS_H
+#define CELLULAR_DATA_PERF_STATS_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "inner_event.h"
+
+namespace OHOS {
+namespace Telephony {
+enum class PerfComponent : uint32_t {
+    HANDLER = 0,
+    CONTROLLER,
+    MONITOR,
+    STATE_MACHINE,
+    COMPONENT_COUNT,
+};
+
+/**
+ * Per event id latency statistics of the cellular data event handlers.
+ * Every handler thread owns its histogram table and records without locking,
+ * the dump merges all tables.
+ */
+class CellularDataPerfStats {
+public:
+    /**
+     * Record one handled event
+     *
+     * @param component handler type which processed the event
+     * @param slotId card slot identification, -1 if unknown
+     * @param eventId inner event id
+     * @param queueDelayUs time between the scheduled handle time and the start of processing
+     * @param handleTimeUs time spent in ProcessEvent
+     */
+    static void Record(PerfComponent component, int32_t slotId, uint32_t eventId, int64_t queueDelayUs,
+        int64_t handleTimeUs);
+
+    /**
+     * Record the time from ps attach until every enabled apn is connected
+     *
+     * @param slotId card slot identification
+     * @param apnCount number of apns that were brought up
+     * @param bringUpUs time since the attach
+     */
+    static void RecordPdnBringUp(int32_t slotId, uint32_t apnCount, int64_t bringUpUs);
+
+    /**
+     * Get p50/p99/max of queueing delay and handling time per event and per slot
+     *
+     * @return dump string, one line per event
+     */
+    static std::string Dump();
+
+    static uint32_t GetBucketIndex(uint64_t value);
+    static uint64_t GetBucketLowerBound(uint32_t index);
+};
+
+class CellularDataPerfScope {
+public:
+    CellularDataPerfScope(PerfComponent component, int32_t slotId, const AppExecFwk::InnerEvent::Pointer &event);
+    ~CellularDataPerfScope();
+
+private:
+    PerfComponent component_;
+    int32_t slotId_;
+    uint32_t eventId_ = 0;
+    int64_t queueDelayUs_ = 0;
+    std::chrono::steady_clock::time_point beginTime_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // CELLULAR_DATA_PERF_STATS_H
@@ -16,10 +16,14 @@
 #ifndef CELLULAR_DATA_RDB_HELPER_H
 #define CELLULAR_DATA_RDB_HELPER_H
 
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <regex>
 #include <singleton.h>
 
 #include "cellular_data_types.h"
+#include "data_share_helper_pool.h"
 #include "datashare_helper.h"
 #include "iservice_registry.h"
 #include "string_ex.h"
@@ -31,14 +35,37 @@ struct PdpProfile;
 static constexpr int SETUP_DATA_AUTH_NONE = 0;
 static constexpr int SETUP_DATA_AUTH_PAP_CHAP = 3;
 static constexpr int DB_CONNECT_MAX_WAIT_TIME = 5;
+static constexpr size_t MAX_APN_CACHE_SIZE = 32;
 class CellularDataRdbHelper : public DelayedSingleton<CellularDataRdbHelper> {
     DECLARE_DELAYED_SINGLETON(CellularDataRdbHelper);
 
+    struct PdpProfileColumns {
+        int profileId = -1;
+        int profileName = -1;
+        int mcc = -1;
+        int mnc = -1;
+        int apn = -1;
+        int authUser = -1;
+        int authType = -1;
+        int authPwd = -1;
+        int apnTypes = -1;
+        int pdpProtocol = -1;
+        int roamPdpProtocol = -1;
+        int mvnoType = -1;
+        int mvnoMatchData = -1;
+        int edited = -1;
+        int proxyIpAddress = -1;
+        int homeUrl = -1;
+        int mmsIpAddress = -1;
+        int server = -1;
+    };
+
 public:
     bool QueryApns(const std::string &mcc, const std::string &mnc, std::vector<PdpProfile> &apnVec, int32_t slotId,
         std::string &errMsg);
-    bool QueryMvnoApnsByType(const std::string &mcc, const std::string &mnc, const std::string &mvnoType,
-        const std::string &mvnoDataFromSim, std::vector<PdpProfile> &mvnoApnVec, int32_t slotId);
+    bool QueryMvnoApns(const std::string &mcc, const std::string &mnc,
+        const std::vector<std::pair<std::string, std::string>> &mvnoDataFromSim, std::vector<PdpProfile> &mvnoApnVec,
+        int32_t slotId);
     bool QueryPreferApn(int32_t slotId, std::vector<PdpProfile> &apnVec, const int waitTime = 2);
     void RegisterObserver(const sptr<AAFwk::IDataAbilityObserver> &dataObserver);
     void UnRegisterObserver(const sptr<AAFwk::IDataAbilityObserver> &dataObserver);
@@ -46,22 +73,42 @@ public:
     void QueryApnIds(const ApnInfo &apnInfo, std::vector<uint32_t> &apnIdList);
     int32_t SetPreferApn(int32_t apnId);
     void QueryAllApnInfo(std::vector<ApnInfo> &apnInfoList);
+    void InvalidateApnCache();
+    std::string GetApnCacheDump();
+    std::string GetHelperPoolDump();
 
 private:
     std::shared_ptr<DataShare::DataShareHelper> CreateDataAbilityHelper(const int waitTime = 2);
+    std::shared_ptr<DataShare::DataShareHelper> WatchPdpProfileProvider(
+        const std::shared_ptr<DataShare::DataShareHelper> &helper);
+    std::shared_ptr<DataShare::DataShareHelper> AcquireDataAbilityHelper(const int waitTime = 2);
     int Update(const DataShare::DataShareValuesBucket &value, const DataShare::DataSharePredicates &predicates);
     int Insert(const DataShare::DataShareValuesBucket &values);
     void ReadApnResult(const std::shared_ptr<DataShare::DataShareResultSet> &result, std::vector<PdpProfile> &apnVec);
     void ReadMvnoApnResult(const std::shared_ptr<DataShare::DataShareResultSet> &result,
-        const std::string &mvnoDataFromSim, std::vector<PdpProfile> &apnVec);
+        const std::vector<std::pair<std::string, std::string>> &mvnoDataFromSim, std::vector<PdpProfile> &apnVec);
     bool IsMvnoDataMatched(const std::string &mvnoDataFromSim, const PdpProfile &apnBean);
     void MakePdpProfile(const std::shared_ptr<DataShare::DataShareResultSet> &result, int i, PdpProfile &apnBean);
+    void MakePdpProfile(const std::shared_ptr<DataShare::DataShareResultSet> &result, int i,
+        const PdpProfileColumns &columns, PdpProfile &apnBean);
+    void GetPdpProfileColumns(const std::shared_ptr<DataShare::DataShareResultSet> &result,
+        PdpProfileColumns &columns);
     int32_t GetSimId();
     void GetApnInfo(ApnInfo &apnInfo, int rowIndex, std::shared_ptr<DataShare::DataShareResultSet> result);
     std::string GetOpKey(int slotId);
+    static std::string MakeApnCacheKey(int32_t simId, const std::string &mccmnc, const std::string &mvnoKey);
+    bool GetCachedApns(const std::string &key, std::vector<PdpProfile> &apnVec);
+    void PutCachedApns(const std::string &key, uint64_t version, const std::vector<PdpProfile> &apnVec);
+    uint64_t GetApnCacheVersion();
 
 private:
     Uri cellularDataUri_;
+    std::shared_ptr<DataShareHelperPool> helperPool_;
+    std::mutex apnCacheMutex_;
+    std::map<std::string, std::vector<PdpProfile>> apnCache_;
+    uint64_t apnCacheVersion_ = 0;
+    std::atomic<uint64_t> apnCacheHitCount_ = 0;
+    std::atomic<uint64_t> apnCacheMissCount_ = 0;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -18,6 +18,7 @@
 
 #include <singleton.h>
 
+#include "data_share_helper_pool.h"
 #include "datashare_helper.h"
 #include "iservice_registry.h"
 #include "system_ability_definition.h"
@@ -52,6 +53,14 @@ public:
     int32_t GetValue(Uri &uri, const std::string &column, int32_t &value);
     int32_t PutValue(Uri &uri, const std::string &column, int value);
     std::shared_ptr<DataShare::DataShareHelper> CreateDataShareHelper();
+    std::string GetHelperPoolDump();
+
+private:
+    std::shared_ptr<DataShare::DataShareHelper> CreateDataShareHelper(sptr<IRemoteObject> &watchedRemote);
+    std::shared_ptr<DataShare::DataShareHelper> AcquireDataShareHelper();
+
+private:
+    std::shared_ptr<DataShareHelperPool> helperPool_;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DATA_SETUP_TIMELINE_H
+#define DATA_SETUP_TIMELINE_H
+
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace Telephony {
+enum class SetupStage : uint32_t {
+    REQUEST_NET = 0,
+    MSG_REQUEST_NETWORK,
+    MSG_ESTABLISH_DATA_CONNECTION,
+    ATTEMPT_CHECKS_PASSED,
+    DO_CONNECT,
+    PDP_CONTEXT_DONE,
+    ACTIVE_ENTERED,
+    NETWORK_INFO_UPDATED,
+    STAGE_COUNT,
+};
+
+/**
+ * Per attempt timeline of the data call setup, from RequestNet to the net supplier being available.
+ * The open timeline of one apn on one slot collects monotonic stage timestamps, finished timelines
+ * are kept in a ring buffer for dump, every stage from DoConnect on is also exported as a HiTrace
+ * async slice keyed on the connectId of the attempt.
+ */
+class DataSetupTimeline {
+public:
+    /**
+     * Mark that the setup of the apn reached the stage
+     *
+     * @param slotId card slot identification
+     * @param apnId apn id of the connection, see ApnManager::FindApnIdByApnName
+     * @param stage reached stage
+     * @param connectId connectId_ of the state machine, -1 if not known yet
+     */
+    static void Mark(int32_t slotId, int32_t apnId, SetupStage stage, int32_t connectId = -1);
+
+    /**
+     * Close the open timeline of the apn, called when the connection goes inactive or the request is
+     * released. An attempt that reached DoConnect is kept for dump as failed.
+     *
+     * @param slotId card slot identification
+     * @param apnId apn id of the connection
+     */
+    static void Abort(int32_t slotId, int32_t apnId);
+
+    /**
+     * Get the last finished timelines, one line per attempt
+     *
+     * @return dump string
+     */
+    static std::string Dump();
+
+    static void Clear();
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // DATA_SETUP_TIMELINE_H
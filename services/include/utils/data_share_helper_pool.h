@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DATA_SHARE_HELPER_POOL_H
+#define DATA_SHARE_HELPER_POOL_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#include "datashare_helper.h"
+#include "iremote_object.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr int64_t DATA_SHARE_HELPER_IDLE_TIMEOUT_MS = 60 * 1000;
+
+/**
+ * Keeps one long-lived DataShareHelper instead of creating and releasing one per operation.
+ * The helper is created lazily by the creator passed to Acquire, and dropped when the watched
+ * provider dies, when a caller reports a failure through Invalidate, or when Acquire finds it
+ * unused for longer than the idle timeout. Helpers handed out by Acquire are released
+ * automatically once the last user drops them, so callers must not call Release on them.
+ */
+class DataShareHelperPool : public std::enable_shared_from_this<DataShareHelperPool> {
+public:
+    using HelperCreator = std::function<std::shared_ptr<DataShare::DataShareHelper>(sptr<IRemoteObject> &)>;
+
+    explicit DataShareHelperPool(int64_t idleTimeoutMs = DATA_SHARE_HELPER_IDLE_TIMEOUT_MS);
+    ~DataShareHelperPool();
+    std::shared_ptr<DataShare::DataShareHelper> Acquire(const HelperCreator &creator);
+    void Invalidate();
+
+    /**
+     * Watch the provider of the pooled helper when its remote object is only known after creation
+     *
+     * @param helper helper returned by the creator, ignored if it is no longer pooled
+     * @param remote remote object of the provider serving the helper
+     */
+    void WatchRemote(const DataShare::DataShareHelper *helper, const sptr<IRemoteObject> &remote);
+    uint64_t GetCreateCount() const;
+    uint64_t GetReuseCount() const;
+    std::string GetDump() const;
+
+private:
+    class RemoteDeathRecipient : public IRemoteObject::DeathRecipient {
+    public:
+        explicit RemoteDeathRecipient(std::weak_ptr<DataShareHelperPool> pool) : pool_(std::move(pool)) {}
+        ~RemoteDeathRecipient() override = default;
+        void OnRemoteDied(const wptr<IRemoteObject> &remote) override;
+
+    private:
+        std::weak_ptr<DataShareHelperPool> pool_;
+    };
+
+    void ResetLocked();
+    void WatchRemoteLocked(const sptr<IRemoteObject> &remote);
+    static int64_t GetSteadyTimeMs();
+
+private:
+    int64_t idleTimeoutMs_;
+    std::mutex mutex_;
+    std::shared_ptr<DataShare::DataShareHelper> helper_;
+    sptr<IRemoteObject> watchedRemote_;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient_;
+    int64_t lastUseTimeMs_ = 0;
+    std::atomic<uint64_t> createCount_ = 0;
+    std::atomic<uint64_t> reuseCount_ = 0;
+    std::atomic<uint64_t> missCount_ = 0;
+    std::atomic<uint64_t> idleReleaseCount_ = 0;
+    std::atomic<uint64_t> remoteDiedCount_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // DATA_SHARE_HELPER_POOL_H
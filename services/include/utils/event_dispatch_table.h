@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EVENT_DISPATCH_TABLE_H
+#define EVENT_DISPATCH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "inner_event.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Not constexpr on purpose, reaching it while a table is constant initialized stops the build
+ */
+inline void DuplicateEventIdInDispatchTable() {}
+
+template<typename Owner, typename Ret>
+struct EventHandlerEntry {
+    uint32_t eventId;
+    Ret (Owner::*handler)(const AppExecFwk::InnerEvent::Pointer &event);
+};
+
+/**
+ * Event id to member function table, sorted by event id when it is constant initialized.
+ * Declare it as a function local static constexpr so that all instances of the owner share
+ * one read only copy, the lookup is a binary search over a flat array without any allocation.
+ * An event id registered twice fails the constant initialization.
+ */
+template<typename Owner, typename Ret, size_t N>
+class EventDispatchTable {
+public:
+    using Entry = EventHandlerEntry<Owner, Ret>;
+    using Handler = Ret (Owner::*)(const AppExecFwk::InnerEvent::Pointer &event);
+
+    constexpr explicit EventDispatchTable(const Entry (&entries)[N]) : entries_ {}
+    {
+        for (size_t i = 0; i < N; i++) {
+            size_t pos = i;
+            for (; pos > 0 && entries_[pos - 1].eventId > entries[i].eventId; pos--) {
+                entries_[pos] = entries_[pos - 1];
+            }
+            entries_[pos] = entries[i];
+            if (pos > 0 && entries_[pos - 1].eventId == entries_[pos].eventId) {
+                DuplicateEventIdInDispatchTable();
+            }
+        }
+    }
+
+    /**
+     * Find the handler of one event
+     *
+     * @param eventId inner event id
+     * @return member function of the owner, nullptr if the event is not handled
+     */
+    constexpr Handler Find(uint32_t eventId) const
+    {
+        size_t low = 0;
+        size_t high = N;
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (entries_[mid].eventId < eventId) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        if (low < N && entries_[low].eventId == eventId) {
+            return entries_[low].handler;
+        }
+        return nullptr;
+    }
+
+    constexpr size_t Size() const
+    {
+        return N;
+    }
+
+private:
+    Entry entries_[N];
+};
+
+template<typename Owner, typename Ret, size_t N>
+constexpr EventDispatchTable<Owner, Ret, N> MakeEventDispatchTable(const EventHandlerEntry<Owner, Ret> (&entries)[N])
+{
+    return EventDispatchTable<Owner, Ret, N>(entries);
+}
+} // namespace Telephony
+} // namespace OHOS
+#endif // EVENT_DISPATCH_TABLE_H
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LINK_CONFIG_TABLE_H
+#define LINK_CONFIG_TABLE_H
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "cellular_data_constant.h"
+#include "core_manager_inner.h"
+
+namespace OHOS {
+namespace Telephony {
+enum class LinkConfigNrMode : size_t {
+    NR_MODE_NONE = 0,
+    NR_MODE_NSA,
+    NR_MODE_NSA_MMWAVE,
+    NR_MODE_COUNT,
+};
+
+/**
+ * Bandwidth and tcp buffer configuration resolved for every (radio tech, NR sub-state, frequency type)
+ * once when the configuration is loaded, so the lookups on the link update path are plain array reads.
+ * Instances are immutable and published as a whole when the operator configuration changes.
+ */
+class LinkConfigTable {
+public:
+    static constexpr size_t RADIO_TECH_COUNT = static_cast<size_t>(RadioTech::RADIO_TECHNOLOGY_NR) + 1;
+    static constexpr size_t NR_MODE_COUNT = static_cast<size_t>(LinkConfigNrMode::NR_MODE_COUNT);
+
+    static LinkConfigNrMode GetNrMode(NrState nrState, FrequencyType frequencyType);
+    static std::shared_ptr<const LinkConfigTable> Build(const std::map<std::string, LinkBandwidthInfo> &bandwidths,
+        const std::map<std::string, std::string> &tcpBuffers);
+    bool GetBandwidth(int32_t radioTech, LinkConfigNrMode nrMode, LinkBandwidthInfo &linkBandwidthInfo) const;
+    bool GetTcpBuffer(int32_t radioTech, LinkConfigNrMode nrMode, std::string &tcpBuffer) const;
+
+private:
+    struct Entry {
+        bool hasBandwidth = false;
+        LinkBandwidthInfo bandwidth;
+        bool hasTcpBuffer = false;
+        std::string tcpBuffer;
+    };
+
+    static std::string GetBandwidthConfigName(int32_t radioTech, LinkConfigNrMode nrMode);
+    static std::string GetTcpBufferConfigName(int32_t radioTech, LinkConfigNrMode nrMode);
+    const Entry *GetEntry(int32_t radioTech, LinkConfigNrMode nrMode) const;
+
+private:
+    std::array<std::array<Entry, NR_MODE_COUNT>, RADIO_TECH_COUNT> entries_ {};
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // LINK_CONFIG_TABLE_H
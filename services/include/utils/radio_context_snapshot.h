@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RADIO_CONTEXT_SNAPSHOT_H
+#define RADIO_CONTEXT_SNAPSHOT_H
+
+#include <memory>
+
+#include "core_manager_inner.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Immutable copy of the modem and network state of one slot used by the data setup decisions.
+ * The handler captures a new one when it receives a radio event that changes any of the fields,
+ * so the decisions taken between two events see the same state without querying the core service.
+ */
+struct RadioContextSnapshot {
+    int32_t psRadioTech = static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_INVALID);
+    int32_t psRegState = -1;
+    bool psRoaming = false;
+    SimState simState = SimState::SIM_STATE_UNKNOWN;
+    NrState nrState {};
+    FrequencyType frequencyType {};
+
+    bool IsPsAttached() const;
+    bool IsSimStateReadyOrLoaded() const;
+
+    /**
+     * Query the current state of the slot from CoreManagerInner
+     *
+     * @param slotId card slot identification
+     * @return new snapshot
+     */
+    static std::shared_ptr<const RadioContextSnapshot> Capture(int32_t slotId);
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // RADIO_CONTEXT_SNAPSHOT_H
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STALL_DETECTOR_H
+#define STALL_DETECTOR_H
+
+#include <cstdint>
+#include <deque>
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Traffic of the cellular interface during one stall detection round.
+ */
+struct TrafficDelta {
+    int64_t txPackets = 0;
+    int64_t rxPackets = 0;
+};
+
+struct StallDetectorConfig {
+    /** Number of rounds kept in the sliding window */
+    int32_t windowSize = 4;
+    /** Packets that must go out unanswered since the link last answered before a stall is reported */
+    int64_t minTxPackets = 10;
+    /** Consecutive rounds that must send without receiving before a stall is reported */
+    int32_t minSilentRounds = 2;
+    /** Percentage of the active rounds of the window that must send without receiving */
+    int32_t confidencePercent = 50;
+};
+
+/**
+ * Decides whether the data link is stalled from the TX/RX deltas of the last rounds instead of a
+ * single packet threshold, so a short burst of unanswered packets does not start the recovery.
+ * Unanswered packets are counted over the whole silent streak rather than the window only, so a
+ * slow link that sends a few packets per round and stays silent is still caught.
+ * The class has no dependency on the service so the same code runs in the offline trace evaluator.
+ */
+class StallDetector {
+public:
+    explicit StallDetector(const StallDetectorConfig &config = StallDetectorConfig());
+    ~StallDetector() = default;
+
+    void SetConfig(const StallDetectorConfig &config);
+    const StallDetectorConfig &GetConfig() const;
+
+    /**
+     * Add the traffic of the last round, the oldest round leaves the window when it is full
+     *
+     * @param delta packets and bytes sent and received since the previous round
+     */
+    void AddSample(const TrafficDelta &delta);
+
+    /**
+     * @return true if the silent streak and the window hold enough unanswered traffic to start the recovery
+     */
+    bool IsStalled() const;
+
+    /**
+     * @return percentage of the active rounds of the window that sent without receiving
+     */
+    int32_t GetConfidence() const;
+
+    /**
+     * Forget the window, called once the recovery has been triggered or the detection restarts
+     */
+    void Reset();
+
+private:
+    StallDetectorConfig config_;
+    std::deque<TrafficDelta> window_;
+    // rounds with traffic and packets sent since the link last answered, idle rounds do not break it
+    int32_t silentStreakRounds_ = 0;
+    int64_t silentStreakTxPackets_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // STALL_DETECTOR_H
@@ -69,7 +69,11 @@ sptr<ApnItem> ApnHolder::GetCurrentApn() const
 void ApnHolder::SetApnState(ApnProfileState state)
 {
     if (apnState_ != state) {
+        ApnProfileState oldState = apnState_;
         apnState_ = state;
+        if (stateAggregate_ != nullptr) {
+            stateAggregate_->OnStateChanged(apnType_, oldState, state);
+        }
     }
     if (apnState_ == PROFILE_STATE_FAILED) {
         retryPolicy_.ClearRetryApns();
@@ -103,7 +107,7 @@ void ApnHolder::ReleaseDataConnection()
         TELEPHONY_LOGE("ClearConnection fail, object is null");
         return;
     }
-    apnState_ = PROFILE_STATE_DISCONNECTING;
+    SetApnState(PROFILE_STATE_DISCONNECTING);
     AppExecFwk::InnerEvent::Pointer event =
         AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_SM_DISCONNECT, object);
     cellularDataStateMachine_->SendEvent(event);
@@ -252,6 +256,14 @@ bool ApnHolder::IsCompatibleApnItem(const sptr<ApnItem> &newApnItem, const sptr<
         std::strcmp(newApnItem->attr_.mmsIpAddress_, oldApnItem->attr_.mmsIpAddress_) == 0;
 }
 
+void ApnHolder::SetApnStateAggregate(const std::shared_ptr<ApnStateAggregate> &stateAggregate)
+{
+    stateAggregate_ = stateAggregate;
+    if (stateAggregate_ != nullptr) {
+        stateAggregate_->AddHolder(apnType_, apnState_);
+    }
+}
+
 void ApnHolder::SetApnBadState(bool isBad)
 {
     std::shared_lock<std::shared_mutex> lock(apnItemMutex_);
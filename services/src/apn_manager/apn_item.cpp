@@ -12,14 +12,135 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "apn_manager.h"
 #include "cellular_data_utils.h"
 #include "pdp_profile_data.h"
 
 namespace OHOS {
 namespace Telephony {
-ApnItem::ApnItem() = default;
+namespace {
+constexpr size_t MIN_INTERN_PURGE_SIZE = 64;
+std::mutex g_internMutex;
+std::unordered_map<std::string, std::weak_ptr<const std::string>> g_internTable;
+// the expired entries are swept once the table doubles since the last sweep
+size_t g_internPurgeSize = MIN_INTERN_PURGE_SIZE;
+
+void PurgeExpiredInternEntries()
+{
+    for (auto it = g_internTable.begin(); it != g_internTable.end();) {
+        if (it->second.expired()) {
+            it = g_internTable.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    g_internPurgeSize = std::max(MIN_INTERN_PURGE_SIZE, g_internTable.size() * 2);
+}
+} // namespace
+
+std::atomic<uint32_t> ApnItem::liveItemCount_ = 0;
+
+ApnString::ApnString(const char *value)
+    : value_((value == nullptr || *value == '\0') ? nullptr : std::make_shared<const std::string>(value))
+{}
+
+ApnString::ApnString(const std::string &value)
+    : value_(value.empty() ? nullptr : std::make_shared<const std::string>(value))
+{}
+
+InternedApnString::InternedApnString(const char *value)
+    : ApnString((value == nullptr) ? nullptr : Intern(value))
+{}
+
+InternedApnString::InternedApnString(const std::string &value) : ApnString(Intern(value)) {}
 
-ApnItem::~ApnItem() = default;
+std::shared_ptr<const std::string> InternedApnString::Intern(const std::string &value)
+{
+    if (value.empty()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(g_internMutex);
+    std::weak_ptr<const std::string> &entry = g_internTable[value];
+    std::shared_ptr<const std::string> interned = entry.lock();
+    if (interned != nullptr) {
+        return interned;
+    }
+    interned = std::make_shared<const std::string>(value);
+    entry = interned;
+    if (g_internTable.size() >= g_internPurgeSize) {
+        PurgeExpiredInternEntries();
+    }
+    return interned;
+}
+
+size_t InternedApnString::GetInternedCount()
+{
+    std::lock_guard<std::mutex> lock(g_internMutex);
+    size_t count = 0;
+    for (const auto &entry : g_internTable) {
+        if (!entry.second.expired()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+ApnItem::ApnItem()
+{
+    liveItemCount_++;
+}
+
+ApnItem::~ApnItem()
+{
+    liveItemCount_--;
+}
+
+std::string ApnItem::GetMemoryDump()
+{
+    uint32_t itemCount = liveItemCount_.load();
+    size_t fixedBytes = itemCount * sizeof(Attribute);
+    size_t compactBytes = itemCount * sizeof(CompactAttribute);
+    std::ostringstream oss;
+    oss << "items:" << itemCount << " fixed layout:" << fixedBytes << "B compact layout:" << compactBytes
+        << "B interned strings:" << InternedApnString::GetInternedCount();
+    return oss.str();
+}
+
+static void CopyApnString(const ApnString &src, char *dest)
+{
+    if (strcpy_s(dest, ApnItem::ALL_APN_ITEM_CHAR_LENGTH, src.c_str()) != EOK) {
+        TELEPHONY_LOGE("attribute copy fail");
+    }
+}
+
+void ApnItem::CompactAttribute::ToAttribute(Attribute &attr) const
+{
+    CopyApnString(types_, attr.types_);
+    CopyApnString(numeric_, attr.numeric_);
+    attr.profileId_ = profileId_;
+    CopyApnString(protocol_, attr.protocol_);
+    CopyApnString(roamingProtocol_, attr.roamingProtocol_);
+    attr.authType_ = authType_;
+    CopyApnString(apn_, attr.apn_);
+    CopyApnString(apnName_, attr.apnName_);
+    CopyApnString(user_, attr.user_);
+    CopyApnString(password_, attr.password_);
+    attr.isRoamingApn_ = isRoamingApn_;
+    CopyApnString(homeUrl_, attr.homeUrl_);
+    CopyApnString(proxyIpAddress_, attr.proxyIpAddress_);
+    CopyApnString(mmsIpAddress_, attr.mmsIpAddress_);
+    attr.isEdited_ = isEdited_;
+    CopyApnString(snssai_, attr.snssai_);
+    attr.sscMode_ = sscMode_;
+    CopyApnString(dnn_, attr.dnn_);
+    attr.PduSessionType_ = PduSessionType_;
+    attr.RouteBitmap_ = RouteBitmap_;
+}
 
 std::vector<std::string> ApnItem::GetApnTypes() const
 {
@@ -53,6 +174,34 @@ bool ApnItem::CanDealWithType(const std::string &type) const
     return false;
 }
 
+bool ApnItem::CanDealWithTypeMask(uint64_t typeMask) const
+{
+    return (apnTypeMask_ & typeMask) != 0;
+}
+
+uint64_t ApnItem::GetApnTypeMask() const
+{
+    return apnTypeMask_;
+}
+
+uint64_t ApnItem::MakeApnTypeMask(const std::vector<std::string> &apnTypes)
+{
+    uint64_t typeMask = 0;
+    for (std::string apnType : apnTypes) {
+        transform(apnType.begin(), apnType.end(), apnType.begin(), ::tolower);
+        if (apnType == DATA_CONTEXT_ROLE_ALL) {
+            // same as CanDealWithType, "*" serves every type except ia
+            typeMask |= static_cast<uint64_t>(ApnTypes::ALL) & ~static_cast<uint64_t>(ApnTypes::IA);
+            continue;
+        }
+        if (apnType == DATA_CONTEXT_ROLE_DEFAULT) {
+            typeMask |= static_cast<uint64_t>(ApnTypes::INTERNAL_DEFAULT);
+        }
+        typeMask |= static_cast<uint64_t>(ApnManager::FindApnTypeByApnName(apnType));
+    }
+    return typeMask;
+}
+
 sptr<ApnItem> ApnItem::MakeDefaultApn(const std::string &apnType)
 {
     sptr<ApnItem> apnItem = std::make_unique<ApnItem>().release();
@@ -60,22 +209,21 @@ sptr<ApnItem> ApnItem::MakeDefaultApn(const std::string &apnType)
         TELEPHONY_LOGE("apn is null");
         return nullptr;
     }
-    Attribute attr = {"", "46002", DATA_PROFILE_DEFAULT, "IPV4V6", "IPV4V6",
-        DEFAULT_AUTH_TYPE, "cmnet", "CMNET", "", "", false, "", "", "", false, "", 0, "", 0, 0};
-    apnItem->apnTypes_ = CellularDataUtils::Split(apnType, ",");
-    apnItem->attr_ = attr;
-    if (strcpy_s(apnItem->attr_.types_, ALL_APN_ITEM_CHAR_LENGTH, apnType.c_str()) != EOK) {
+    if (apnType.size() >= ALL_APN_ITEM_CHAR_LENGTH) {
         TELEPHONY_LOGE("types_ copy fail");
         return nullptr;
     }
-    if (apnType == "mms") {
-        std::string apn = "cmwap";
-        if (strcpy_s(apnItem->attr_.apn_, ALL_APN_ITEM_CHAR_LENGTH, apn.c_str()) != EOK) {
-            TELEPHONY_LOGE("types_ copy fail");
-            return nullptr;
-        }
-    }
-    TELEPHONY_LOGI("type = %{public}s", apnItem->attr_.types_);
+    apnItem->apnTypes_ = CellularDataUtils::Split(apnType, ",");
+    apnItem->apnTypeMask_ = MakeApnTypeMask(apnItem->apnTypes_);
+    apnItem->attr_.types_ = apnType;
+    apnItem->attr_.numeric_ = "46002";
+    apnItem->attr_.profileId_ = DATA_PROFILE_DEFAULT;
+    apnItem->attr_.protocol_ = "IPV4V6";
+    apnItem->attr_.roamingProtocol_ = "IPV4V6";
+    apnItem->attr_.authType_ = DEFAULT_AUTH_TYPE;
+    apnItem->attr_.apn_ = (apnType == "mms") ? "cmwap" : "cmnet";
+    apnItem->attr_.apnName_ = "CMNET";
+    TELEPHONY_LOGI("type = %{public}s", apnItem->attr_.types_.c_str());
     return apnItem;
 }
 
@@ -86,67 +234,61 @@ sptr<ApnItem> ApnItem::MakeApn(const PdpProfile &apnData)
         TELEPHONY_LOGE("apn is null");
         return nullptr;
     }
+    if (!IsAttributeLengthValid(apnData)) {
+        return nullptr;
+    }
     apnItem->apnTypes_ = CellularDataUtils::Split(apnData.apnTypes, ",");
+    apnItem->apnTypeMask_ = MakeApnTypeMask(apnItem->apnTypes_);
     TELEPHONY_LOGI("MakeApn apnTypes_ = %{public}s", apnData.apnTypes.c_str());
     apnItem->attr_.profileId_ = apnData.profileId;
     apnItem->attr_.authType_ = apnData.authType;
     apnItem->attr_.isRoamingApn_ = apnData.isRoamingApn;
     apnItem->attr_.isEdited_ = apnData.edited;
-    if (strcpy_s(apnItem->attr_.types_, ALL_APN_ITEM_CHAR_LENGTH, apnData.apnTypes.c_str()) != EOK) {
-        TELEPHONY_LOGE("types_ copy fail");
-        return nullptr;
-    }
-    std::string numeric = apnData.mcc + apnData.mnc;
-    if (strcpy_s(apnItem->attr_.numeric_, ALL_APN_ITEM_CHAR_LENGTH, numeric.c_str()) != EOK) {
-        TELEPHONY_LOGE("numeric_ copy fail");
-        return nullptr;
-    }
-    if (strcpy_s(apnItem->attr_.protocol_, ALL_APN_ITEM_CHAR_LENGTH, apnData.pdpProtocol.c_str()) != EOK) {
-        TELEPHONY_LOGE("protocol_ copy fail");
-        return nullptr;
-    }
-    if (strcpy_s(apnItem->attr_.roamingProtocol_, ALL_APN_ITEM_CHAR_LENGTH,
-        apnData.roamPdpProtocol.c_str()) != EOK) {
-        TELEPHONY_LOGE("roamingProtocol_ copy fail");
-        return nullptr;
-    }
-    if (strcpy_s(apnItem->attr_.apn_, ALL_APN_ITEM_CHAR_LENGTH, apnData.apn.c_str()) != EOK) {
-        TELEPHONY_LOGE("apn_ copy fail");
-        return nullptr;
-    }
-    if (strcpy_s(apnItem->attr_.apnName_, ALL_APN_ITEM_CHAR_LENGTH, apnData.profileName.c_str()) != EOK) {
-        TELEPHONY_LOGE("apnName_ copy fail");
-        return nullptr;
-    }
-    if (strcpy_s(apnItem->attr_.user_, ALL_APN_ITEM_CHAR_LENGTH, apnData.authUser.c_str()) != EOK) {
-        TELEPHONY_LOGE("user_ copy fail");
-        return nullptr;
-    }
-    if (strcpy_s(apnItem->attr_.password_, ALL_APN_ITEM_CHAR_LENGTH, apnData.authPwd.c_str()) != EOK) {
-        TELEPHONY_LOGE("password_ copy fail");
-        return nullptr;
-    }
+    apnItem->attr_.types_ = apnData.apnTypes;
+    apnItem->attr_.numeric_ = apnData.mcc + apnData.mnc;
+    apnItem->attr_.protocol_ = apnData.pdpProtocol;
+    apnItem->attr_.roamingProtocol_ = apnData.roamPdpProtocol;
+    apnItem->attr_.apn_ = apnData.apn;
+    apnItem->attr_.apnName_ = apnData.profileName;
+    apnItem->attr_.user_ = apnData.authUser;
+    apnItem->attr_.password_ = apnData.authPwd;
     return BuildOtherApnAttributes(apnItem, apnData);
 }
 
 sptr<ApnItem> ApnItem::BuildOtherApnAttributes(sptr<ApnItem> &apnItem, const PdpProfile &apnData)
 {
-    if (strcpy_s(apnItem->attr_.homeUrl_, ALL_APN_ITEM_CHAR_LENGTH, apnData.homeUrl.c_str()) != EOK) {
-        TELEPHONY_LOGE("homeUrl_ copy fail");
-        return nullptr;
-    }
-    if (strcpy_s(apnItem->attr_.proxyIpAddress_, ALL_APN_ITEM_CHAR_LENGTH, apnData.proxyIpAddress.c_str()) != EOK) {
-        TELEPHONY_LOGE("proxyIpAddress_ copy fail");
-        return nullptr;
-    }
-    if (strcpy_s(apnItem->attr_.mmsIpAddress_, ALL_APN_ITEM_CHAR_LENGTH, apnData.mmsIpAddress.c_str()) != EOK) {
-        TELEPHONY_LOGE("mmsIpAddress_ copy fail");
-        return nullptr;
-    }
-    TELEPHONY_LOGI("The APN name is:%{public}s", apnItem->attr_.apnName_);
+    apnItem->attr_.homeUrl_ = apnData.homeUrl;
+    apnItem->attr_.proxyIpAddress_ = apnData.proxyIpAddress;
+    apnItem->attr_.mmsIpAddress_ = apnData.mmsIpAddress;
+    TELEPHONY_LOGI("The APN name is:%{public}s", apnItem->attr_.apnName_.c_str());
     return apnItem;
 }
 
+bool ApnItem::IsAttributeLengthValid(const PdpProfile &apnData)
+{
+    // values must still fit the fixed Attribute layout used for IPC
+    const std::pair<const char *, size_t> fields[] = {
+        { "types_", apnData.apnTypes.size() },
+        { "numeric_", apnData.mcc.size() + apnData.mnc.size() },
+        { "protocol_", apnData.pdpProtocol.size() },
+        { "roamingProtocol_", apnData.roamPdpProtocol.size() },
+        { "apn_", apnData.apn.size() },
+        { "apnName_", apnData.profileName.size() },
+        { "user_", apnData.authUser.size() },
+        { "password_", apnData.authPwd.size() },
+        { "homeUrl_", apnData.homeUrl.size() },
+        { "proxyIpAddress_", apnData.proxyIpAddress.size() },
+        { "mmsIpAddress_", apnData.mmsIpAddress.size() },
+    };
+    for (const auto &[name, size] : fields) {
+        if (size >= ALL_APN_ITEM_CHAR_LENGTH) {
+            TELEPHONY_LOGE("%{public}s copy fail", name);
+            return false;
+        }
+    }
+    return true;
+}
+
 bool ApnItem::IsSimilarPdpProfile(const PdpProfile &newPdpProfile, const PdpProfile &oldPdpProfile)
 {
     if ((newPdpProfile.apnTypes.find(DATA_CONTEXT_ROLE_DEFAULT) != std::string::npos) &&
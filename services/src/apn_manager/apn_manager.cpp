@@ -15,6 +15,9 @@
 
 #include "apn_manager.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "cellular_data_hisysevent.h"
 #include "core_manager_inner.h"
 #include "telephony_ext_wrapper.h"
@@ -78,6 +81,9 @@ constexpr const char *MO_ICCID_1 = "8985302";
 constexpr const char *MO_ICCID_2 = "8985307";
 constexpr const char *MO_UNICOM_MCCMNC = "46001";
 constexpr int32_t ICCID_LEN_MINIMUM = 7;
+constexpr size_t HASH_SEED_MAGIC = 0x9e3779b9;
+constexpr size_t HASH_SEED_SHIFT_LEFT = 6;
+constexpr size_t HASH_SEED_SHIFT_RIGHT = 2;
 
 ApnManager::ApnManager() = default;
 
@@ -250,6 +256,7 @@ void ApnManager::AddApnHolder(const std::string &apnType, const int32_t priority
         TELEPHONY_LOGE("apnHolder is null, type: %{public}s", apnType.c_str());
         return;
     }
+    apnHolder->SetApnStateAggregate(apnStateAggregate_);
     apnHolder->SetApnState(PROFILE_STATE_IDLE);
     apnHolders_.push_back(apnHolder);
     apnIdApnHolderMap_.insert(std::pair<int32_t, sptr<ApnHolder>>(apnId, apnHolder));
@@ -298,6 +305,7 @@ int32_t ApnManager::PushApnItem(int32_t count, int32_t slotId, sptr<ApnItem> ext
     std::unique_lock<std::shared_mutex> lock(mutex_);
     allApnItem_.clear();
     allApnItem_.push_back(extraApnItem);
+    BuildApnTypeIndex();
     CellularDataHiSysEvent::WriteApnInfoBehaviorEvent(slotId, extraApnItem);
     return ++count;
 }
@@ -392,29 +400,23 @@ int32_t ApnManager::CreateMvnoApnItems(int32_t slotId, const std::string &mcc, c
         TELEPHONY_LOGE("get cellularDataRdbHelper failed");
         return count;
     }
-    std::vector<PdpProfile> mvnoApnVec;
     std::u16string spn;
     CoreManagerInner::GetInstance().GetSimSpn(slotId, spn);
-    if (!helper->QueryMvnoApnsByType(mcc, mnc, MvnoType::SPN, Str16ToStr8(spn), mvnoApnVec, slotId)) {
-        TELEPHONY_LOGE("query mvno apns by spn fail");
-        return count;
-    }
     std::u16string imsi;
     CoreManagerInner::GetInstance().GetIMSI(slotId, imsi);
-    if (!helper->QueryMvnoApnsByType(mcc, mnc, MvnoType::IMSI, Str16ToStr8(imsi), mvnoApnVec, slotId)) {
-        TELEPHONY_LOGE("query mvno apns by imsi fail");
-        return count;
-    }
     std::u16string gid1;
     CoreManagerInner::GetInstance().GetSimGid1(slotId, gid1);
-    if (!helper->QueryMvnoApnsByType(mcc, mnc, MvnoType::GID1, Str16ToStr8(gid1), mvnoApnVec, slotId)) {
-        TELEPHONY_LOGE("query mvno apns by gid1 fail");
-        return count;
-    }
     std::u16string iccId;
     CoreManagerInner::GetInstance().GetSimIccId(slotId, iccId);
-    if (!helper->QueryMvnoApnsByType(mcc, mnc, MvnoType::ICCID, Str16ToStr8(iccId), mvnoApnVec, slotId)) {
-        TELEPHONY_LOGE("query mvno apns by iccId fail");
+    std::vector<std::pair<std::string, std::string>> mvnoDataFromSim = {
+        { MvnoType::SPN, Str16ToStr8(spn) },
+        { MvnoType::IMSI, Str16ToStr8(imsi) },
+        { MvnoType::GID1, Str16ToStr8(gid1) },
+        { MvnoType::ICCID, Str16ToStr8(iccId) },
+    };
+    std::vector<PdpProfile> mvnoApnVec;
+    if (!helper->QueryMvnoApns(mcc, mnc, mvnoDataFromSim, mvnoApnVec, slotId)) {
+        TELEPHONY_LOGE("query mvno apns fail");
         return count;
     }
     return MakeSpecificApnItem(mvnoApnVec, slotId);
@@ -458,9 +460,27 @@ int32_t ApnManager::MakeSpecificApnItem(std::vector<PdpProfile> &apnVec, int32_t
         allApnItem_.erase(it);
         allApnItem_.insert(allApnItem_.begin(), apnItem);
     }
+    BuildApnTypeIndex();
     return count;
 }
 
+void ApnManager::BuildApnTypeIndex()
+{
+    apnTypeIndex_.clear();
+    for (const auto &[apnName, apnType] : apnNameApnTypeMap_) {
+        if (apnType == ApnTypes::ALL) {
+            continue;
+        }
+        uint64_t typeMask = static_cast<uint64_t>(apnType);
+        std::vector<sptr<ApnItem>> &apnItems = apnTypeIndex_[typeMask];
+        for (const sptr<ApnItem> &apnItem : allApnItem_) {
+            if (apnItem != nullptr && apnItem->CanDealWithTypeMask(typeMask)) {
+                apnItems.push_back(apnItem);
+            }
+        }
+    }
+}
+
 std::vector<sptr<ApnItem>> ApnManager::FilterMatchedApns(const std::string &requestApnType, const int32_t slotId)
 {
     std::vector<sptr<ApnItem>> matchApnItemList;
@@ -471,7 +491,14 @@ std::vector<sptr<ApnItem>> ApnManager::FilterMatchedApns(const std::string &requ
         FetchBipApns(matchApnItemList);
         return matchApnItemList;
     }
+    uint64_t typeMask = static_cast<uint64_t>(FindApnTypeByApnName(requestApnType));
     std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto iter = apnTypeIndex_.find(typeMask);
+    if (iter != apnTypeIndex_.end()) {
+        matchApnItemList = iter->second;
+        TELEPHONY_LOGD("apn size is :%{public}zu", matchApnItemList.size());
+        return matchApnItemList;
+    }
     for (const sptr<ApnItem> &apnItem : allApnItem_) {
         if (apnItem->CanDealWithType(requestApnType)) {
             matchApnItemList.push_back(apnItem);
@@ -501,8 +528,20 @@ bool ApnManager::IsDataConnectionNotUsed(const std::shared_ptr<CellularDataState
     return true;
 }
 
+bool ApnManager::LoadApnStateWord(uint64_t &stateWord) const
+{
+    stateWord = apnStateAggregate_->Load();
+    // holders put into apnHolders_ without registering are not aggregated, walk them instead
+    return ApnStateAggregate::GetHolderCount(stateWord) == apnHolders_.size();
+}
+
 bool ApnManager::HasAnyConnectedState() const
 {
+    uint64_t stateWord = 0;
+    if (LoadApnStateWord(stateWord)) {
+        return ApnStateAggregate::GetStateCount(stateWord, ApnProfileState::PROFILE_STATE_CONNECTED) > 0 ||
+            ApnStateAggregate::GetStateCount(stateWord, ApnProfileState::PROFILE_STATE_DISCONNECTING) > 0;
+    }
     for (const sptr<ApnHolder> &apnHolder : apnHolders_) {
         if (apnHolder == nullptr) {
             TELEPHONY_LOGE("apn holder is null");
@@ -522,6 +561,10 @@ ApnProfileState ApnManager::GetOverallApnState() const
         TELEPHONY_LOGE("apn overall state is STATE_IDLE");
         return ApnProfileState::PROFILE_STATE_IDLE;
     }
+    uint64_t stateWord = 0;
+    if (LoadApnStateWord(stateWord)) {
+        return GetOverallApnStateFromWord(stateWord);
+    }
     if (HasAnyConnectedState()) {
         TELEPHONY_LOGD("apn overall state is STATE_CONNECTED");
         return ApnProfileState::PROFILE_STATE_CONNECTED;
@@ -547,6 +590,26 @@ ApnProfileState ApnManager::GetOverallApnState() const
     return ApnProfileState::PROFILE_STATE_FAILED;
 }
 
+ApnProfileState ApnManager::GetOverallApnStateFromWord(uint64_t stateWord)
+{
+    if (ApnStateAggregate::GetStateCount(stateWord, ApnProfileState::PROFILE_STATE_CONNECTED) > 0 ||
+        ApnStateAggregate::GetStateCount(stateWord, ApnProfileState::PROFILE_STATE_DISCONNECTING) > 0) {
+        TELEPHONY_LOGD("apn overall state is STATE_CONNECTED");
+        return ApnProfileState::PROFILE_STATE_CONNECTED;
+    }
+    if (ApnStateAggregate::GetStateCount(stateWord, ApnProfileState::PROFILE_STATE_CONNECTING) > 0 ||
+        ApnStateAggregate::GetStateCount(stateWord, ApnProfileState::PROFILE_STATE_RETRYING) > 0) {
+        TELEPHONY_LOGD("apn overall state is STATE_CONNECTING");
+        return ApnProfileState::PROFILE_STATE_CONNECTING;
+    }
+    if (ApnStateAggregate::GetStateCount(stateWord, ApnProfileState::PROFILE_STATE_IDLE) > 0) {
+        TELEPHONY_LOGD("apn overall state is STATE_IDLE");
+        return ApnProfileState::PROFILE_STATE_IDLE;
+    }
+    TELEPHONY_LOGI("apn overall state is STATE_FAILED");
+    return ApnProfileState::PROFILE_STATE_FAILED;
+}
+
 ApnProfileState ApnManager::GetOverallDefaultApnState() const
 {
     if (apnHolders_.empty()) {
@@ -555,16 +618,21 @@ ApnProfileState ApnManager::GetOverallDefaultApnState() const
     }
     ApnProfileState defaultApnState = ApnProfileState::PROFILE_STATE_IDLE;
     ApnProfileState internalApnState = ApnProfileState::PROFILE_STATE_IDLE;
-
-    for (const sptr<ApnHolder> &apnHolder : apnHolders_) {
-        if (apnHolder == nullptr) {
-            continue;
-        }
-        if (apnHolder->GetApnType() == DATA_CONTEXT_ROLE_DEFAULT) {
-            defaultApnState = apnHolder->GetApnState();
-        }
-        if (apnHolder->GetApnType() == DATA_CONTEXT_ROLE_INTERNAL_DEFAULT) {
-            internalApnState = apnHolder->GetApnState();
+    uint64_t stateWord = 0;
+    if (LoadApnStateWord(stateWord)) {
+        defaultApnState = ApnStateAggregate::GetDefaultState(stateWord);
+        internalApnState = ApnStateAggregate::GetInternalDefaultState(stateWord);
+    } else {
+        for (const sptr<ApnHolder> &apnHolder : apnHolders_) {
+            if (apnHolder == nullptr) {
+                continue;
+            }
+            if (apnHolder->GetApnType() == DATA_CONTEXT_ROLE_DEFAULT) {
+                defaultApnState = apnHolder->GetApnState();
+            }
+            if (apnHolder->GetApnType() == DATA_CONTEXT_ROLE_INTERNAL_DEFAULT) {
+                internalApnState = apnHolder->GetApnState();
+            }
         }
     }
     HILOG_COMM_IMPL(LOG_INFO, LOG_DOMAIN, TELEPHONY_LOG_TAG,
@@ -590,11 +658,11 @@ sptr<ApnItem> ApnManager::GetRilAttachApn()
     }
     sptr<ApnItem> attachApn = nullptr;
     for (const sptr<ApnItem> &apnItem : allApnItem_) {
-        if (apnItem->CanDealWithType(DATA_CONTEXT_ROLE_IA)) {
+        if (apnItem->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::IA))) {
             attachApn = apnItem;
             break;
         }
-        if (attachApn == nullptr && apnItem->CanDealWithType(DATA_CONTEXT_ROLE_DEFAULT)) {
+        if (attachApn == nullptr && apnItem->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::DEFAULT))) {
             attachApn = apnItem;
         }
     }
@@ -634,7 +702,7 @@ void ApnManager::FetchBipApns(std::vector<sptr<ApnItem>> &matchApnItemList)
 {
     std::shared_lock<std::shared_mutex> lock(mutex_);
     for (const sptr<ApnItem> &apnItem : allApnItem_) {
-        if (apnItem->CanDealWithType(DATA_CONTEXT_ROLE_BIP)) {
+        if (apnItem->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::BIP))) {
             matchApnItemList.push_back(apnItem);
             return;
         }
@@ -657,12 +725,12 @@ void ApnManager::FetchDunApns(std::vector<sptr<ApnItem>> &matchApnItemList, cons
     if (it != allApnItem_.end()) {
         preferredApn = *it;
     }
-    if (preferredApn != nullptr && preferredApn->CanDealWithType(DATA_CONTEXT_ROLE_DUN)) {
+    if (preferredApn != nullptr && preferredApn->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::DUN))) {
         matchApnItemList.insert(matchApnItemList.begin(), preferredApn);
     }
     if (matchApnItemList.empty()) {
         for (const auto &item : allApnItem_) {
-            if (item->CanDealWithType(DATA_CONTEXT_ROLE_DUN)) {
+            if (item->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::DUN))) {
                 matchApnItemList.push_back(item);
             }
         }
@@ -692,15 +760,35 @@ void ApnManager::ClearAllApnBad()
     }
 }
 
+size_t ApnManager::HashPdpProfileKey(const PdpProfile &profile)
+{
+    // IsSimilarPdpProfile requires apn and mvno fields to be equal, so they are a safe bucket key
+    std::hash<std::string> hasher;
+    size_t seed = 0;
+    for (const std::string *field : { &profile.apn, &profile.mvnoType, &profile.mvnoMatchData }) {
+        seed ^= hasher(*field) + HASH_SEED_MAGIC + (seed << HASH_SEED_SHIFT_LEFT) + (seed >> HASH_SEED_SHIFT_RIGHT);
+    }
+    return seed;
+}
+
 void ApnManager::TryMergeSimilarPdpProfile(std::vector<PdpProfile> &apnVec)
 {
     // coalesce similar APNs to prevent bringing up two data calls with same interface
+    std::vector<size_t> profileHashes(apnVec.size());
+    std::unordered_map<size_t, std::vector<size_t>> buckets;
+    for (size_t i = 0; i < apnVec.size(); i++) {
+        profileHashes[i] = HashPdpProfileKey(apnVec[i]);
+        buckets[profileHashes[i]].push_back(i);
+    }
     std::vector<PdpProfile> newApnVec;
+    newApnVec.reserve(apnVec.size());
     for (size_t i = 0; i < apnVec.size(); i++) {
         if (apnVec[i].profileId == -1) {
             continue;
         }
-        for (size_t j = i + 1; j < apnVec.size(); j++) {
+        const std::vector<size_t> &bucket = buckets[profileHashes[i]];
+        for (auto it = std::upper_bound(bucket.begin(), bucket.end(), i); it != bucket.end(); ++it) {
+            size_t j = *it;
             if (ApnItem::IsSimilarPdpProfile(apnVec[i], apnVec[j])) {
                 MergePdpProfile(apnVec[i], apnVec[j]);
                 apnVec[j].profileId = -1;
@@ -708,7 +796,7 @@ void ApnManager::TryMergeSimilarPdpProfile(std::vector<PdpProfile> &apnVec)
         }
         newApnVec.push_back(apnVec[i]);
     }
-    apnVec.assign(newApnVec.begin(), newApnVec.end());
+    apnVec.swap(newApnVec);
 }
 
 void ApnManager::MergePdpProfile(PdpProfile &newProfile, PdpProfile &oldProfile)
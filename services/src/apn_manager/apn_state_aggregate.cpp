@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "apn_state_aggregate.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr uint32_t STATE_COUNT_BITS = 5;
+constexpr uint64_t STATE_COUNT_MASK = (1ULL << STATE_COUNT_BITS) - 1;
+constexpr uint32_t STATE_NUM = static_cast<uint32_t>(PROFILE_STATE_RETRYING) + 1;
+constexpr uint32_t ROLE_STATE_BITS = 3;
+constexpr uint64_t ROLE_STATE_MASK = (1ULL << ROLE_STATE_BITS) - 1;
+constexpr uint32_t DEFAULT_STATE_SHIFT = STATE_COUNT_BITS * STATE_NUM;
+constexpr uint32_t INTERNAL_DEFAULT_STATE_SHIFT = DEFAULT_STATE_SHIFT + ROLE_STATE_BITS;
+constexpr uint32_t EPOCH_SHIFT = INTERNAL_DEFAULT_STATE_SHIFT + ROLE_STATE_BITS;
+constexpr uint64_t EPOCH_MASK = (1ULL << (64 - EPOCH_SHIFT)) - 1;
+
+bool IsValidState(ApnProfileState state)
+{
+    return static_cast<uint32_t>(state) < STATE_NUM;
+}
+} // namespace
+
+void ApnStateAggregate::AddHolder(const std::string &apnType, ApnProfileState state)
+{
+    if (!IsValidState(state)) {
+        return;
+    }
+    uint64_t expected = stateWord_.load(std::memory_order_relaxed);
+    uint64_t desired = 0;
+    do {
+        desired = UpdateCount(expected, state, true);
+        desired = UpdateRoleState(desired, apnType, state);
+        desired = IncreaseEpoch(desired);
+    } while (!stateWord_.compare_exchange_weak(expected, desired, std::memory_order_release,
+        std::memory_order_relaxed));
+}
+
+void ApnStateAggregate::OnStateChanged(const std::string &apnType, ApnProfileState oldState,
+    ApnProfileState newState)
+{
+    if (oldState == newState || !IsValidState(oldState) || !IsValidState(newState)) {
+        return;
+    }
+    uint64_t expected = stateWord_.load(std::memory_order_relaxed);
+    uint64_t desired = 0;
+    do {
+        desired = UpdateCount(expected, oldState, false);
+        desired = UpdateCount(desired, newState, true);
+        desired = UpdateRoleState(desired, apnType, newState);
+        desired = IncreaseEpoch(desired);
+    } while (!stateWord_.compare_exchange_weak(expected, desired, std::memory_order_release,
+        std::memory_order_relaxed));
+}
+
+uint64_t ApnStateAggregate::Load() const
+{
+    return stateWord_.load(std::memory_order_acquire);
+}
+
+uint32_t ApnStateAggregate::GetStateCount(uint64_t stateWord, ApnProfileState state)
+{
+    if (!IsValidState(state)) {
+        return 0;
+    }
+    return static_cast<uint32_t>((stateWord >> (STATE_COUNT_BITS * state)) & STATE_COUNT_MASK);
+}
+
+uint32_t ApnStateAggregate::GetHolderCount(uint64_t stateWord)
+{
+    uint32_t count = 0;
+    for (uint32_t state = 0; state < STATE_NUM; state++) {
+        count += GetStateCount(stateWord, static_cast<ApnProfileState>(state));
+    }
+    return count;
+}
+
+ApnProfileState ApnStateAggregate::GetDefaultState(uint64_t stateWord)
+{
+    return static_cast<ApnProfileState>((stateWord >> DEFAULT_STATE_SHIFT) & ROLE_STATE_MASK);
+}
+
+ApnProfileState ApnStateAggregate::GetInternalDefaultState(uint64_t stateWord)
+{
+    return static_cast<ApnProfileState>((stateWord >> INTERNAL_DEFAULT_STATE_SHIFT) & ROLE_STATE_MASK);
+}
+
+uint32_t ApnStateAggregate::GetEpoch(uint64_t stateWord)
+{
+    return static_cast<uint32_t>((stateWord >> EPOCH_SHIFT) & EPOCH_MASK);
+}
+
+uint64_t ApnStateAggregate::UpdateCount(uint64_t stateWord, ApnProfileState state, bool increase)
+{
+    uint32_t shift = STATE_COUNT_BITS * state;
+    uint64_t count = (stateWord >> shift) & STATE_COUNT_MASK;
+    if (increase && count < STATE_COUNT_MASK) {
+        count++;
+    } else if (!increase && count > 0) {
+        count--;
+    }
+    return (stateWord & ~(STATE_COUNT_MASK << shift)) | (count << shift);
+}
+
+uint64_t ApnStateAggregate::UpdateRoleState(uint64_t stateWord, const std::string &apnType, ApnProfileState state)
+{
+    uint32_t shift = 0;
+    if (apnType == DATA_CONTEXT_ROLE_DEFAULT) {
+        shift = DEFAULT_STATE_SHIFT;
+    } else if (apnType == DATA_CONTEXT_ROLE_INTERNAL_DEFAULT) {
+        shift = INTERNAL_DEFAULT_STATE_SHIFT;
+    } else {
+        return stateWord;
+    }
+    return (stateWord & ~(ROLE_STATE_MASK << shift)) | ((static_cast<uint64_t>(state) & ROLE_STATE_MASK) << shift);
+}
+
+uint64_t ApnStateAggregate::IncreaseEpoch(uint64_t stateWord)
+{
+    uint64_t epoch = ((stateWord >> EPOCH_SHIFT) + 1) & EPOCH_MASK;
+    return (stateWord & ~(EPOCH_MASK << EPOCH_SHIFT)) | (epoch << EPOCH_SHIFT);
+}
+} // namespace Telephony
+} // namespace OHOS
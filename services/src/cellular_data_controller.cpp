@@ -15,6 +15,7 @@
 
 #include "cellular_data_controller.h"
 
+#include "cellular_data_perf_stats.h"
 #include "core_manager_inner.h"
 #include "network_search_callback.h"
 static constexpr int32_t SIM_ACCOUNT_LOADED_REGISTER = 0;
@@ -30,6 +31,9 @@ CellularDataController::CellularDataController(int32_t slotId)
 CellularDataController::~CellularDataController()
 {
     UnRegisterEvents();
+    if (cellularDataHandler_ != nullptr) {
+        cellularDataHandler_->DrainConnectionPool();
+    }
     if (systemAbilityListener_ != nullptr) {
         auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
         if (samgrProxy != nullptr) {
@@ -173,6 +177,7 @@ void CellularDataController::ProcessEvent(const AppExecFwk::InnerEvent::Pointer
         TELEPHONY_LOGE("Slot%{public}d: event is null.", slotId_);
         return;
     }
+    CellularDataPerfScope perfScope(PerfComponent::CONTROLLER, slotId_, event);
     size_t eventId = event->GetInnerEventId();
     switch (eventId) {
         case CellularDataEventCode::MSG_ASYNCHRONOUS_REGISTER_EVENT_ID:
@@ -495,5 +500,14 @@ bool CellularDataController::GetInternalActReportInfo(ApnActivateReportInfo &inf
     return true;
 }
 
+std::string CellularDataController::GetPendingIntentDump() const
+{
+    if (cellularDataHandler_ == nullptr) {
+        TELEPHONY_LOGE("Slot%{public}d: cellularDataHandler is null", slotId_);
+        return "";
+    }
+    return cellularDataHandler_->GetPendingIntentDump();
+}
+
 } // namespace Telephony
 } // namespace OHOS
@@ -15,8 +15,13 @@
 
 #include "cellular_data_dump_helper.h"
 
+#include "cellular_data_net_agent.h"
+#include "cellular_data_perf_stats.h"
+#include "cellular_data_rdb_helper.h"
 #include "cellular_data_service.h"
+#include "cellular_data_settings_rdb_helper.h"
 #include "core_manager_inner.h"
+#include "data_setup_timeline.h"
 #include "enum_convert.h"
 
 namespace OHOS {
@@ -32,6 +37,12 @@ bool CellularDataDumpHelper::Dump(const std::vector<std::string> &args, std::str
             return true;
         }
     }
+    for (const std::string &arg : args) {
+        if (arg == "-perf_dump") {
+            ShowPerfDump(result);
+            return true;
+        }
+    }
     ShowCellularDataInfo(result);
     return true;
 }
@@ -64,6 +75,14 @@ void CellularDataDumpHelper::ShowHelp(std::string &result) const
     result.append("dump performance statistics\n");
 }
 
+void CellularDataDumpHelper::ShowPerfDump(std::string &result) const
+{
+    result.append("Ohos cellular data event latency (us): \n");
+    result.append(CellularDataPerfStats::Dump());
+    result.append("Ohos cellular data setup timeline: \n");
+    result.append(DataSetupTimeline::Dump());
+}
+
 void CellularDataDumpHelper::ShowCellularDataInfo(std::string &result) const
 {
     CellularDataService &dataService = DelayedRefSingleton<CellularDataService>::GetInstance();
@@ -86,6 +105,30 @@ void CellularDataDumpHelper::ShowCellularDataInfo(std::string &result) const
     result.append("FlowDataInfo                 : ");
     result.append(dataService.GetFlowDataInfoDump());
     result.append("\n");
+    result.append("PendingIntent                : ");
+    result.append(dataService.GetPendingIntentDump());
+    result.append("\n");
+    result.append("ApnCache                     : ");
+    result.append(dataService.GetApnCacheDump());
+    result.append("\n");
+    result.append("ApnMemory                    : ");
+    result.append(ApnItem::GetMemoryDump());
+    result.append("\n");
+    result.append("CellNetIdCache               : ");
+    result.append(CellularDataNetAgent::GetInstance().GetCellNetIdCacheDump());
+    result.append("\n");
+    result.append("NetInfoPush                  : ");
+    result.append(CellularDataNetAgent::GetInstance().GetNetInfoPushDump());
+    result.append("\n");
+    std::shared_ptr<CellularDataRdbHelper> rdbHelper = CellularDataRdbHelper::GetInstance();
+    std::shared_ptr<CellularDataSettingsRdbHelper> settingHelper = CellularDataSettingsRdbHelper::GetInstance();
+    if (rdbHelper != nullptr && settingHelper != nullptr) {
+        result.append("DataShareHelperPool          : apn ");
+        result.append(rdbHelper->GetHelperPoolDump());
+        result.append(" settings ");
+        result.append(settingHelper->GetHelperPoolDump());
+        result.append("\n");
+    }
     result.append("ServiceRunningState          : ");
     result.append(std::to_string(dataService.GetServiceRunningState()));
     result.append("\n");
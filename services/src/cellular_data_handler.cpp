@@ -16,12 +16,15 @@
 #include "cellular_data_handler.h"
 #include "cellular_data_error.h"
 #include "cellular_data_hisysevent.h"
+#include "cellular_data_perf_stats.h"
 #include "cellular_data_service.h"
 #include "cellular_data_settings_rdb_helper.h"
 #include "cellular_data_utils.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
 #include "core_manager_inner.h"
+#include "data_setup_timeline.h"
+#include "event_dispatch_table.h"
 #include "hitrace_meter.h"
 #include "net_all_capabilities.h"
 #include "telephony_ext_wrapper.h"
@@ -79,8 +82,10 @@ void CellularDataHandler::Init()
     connectionManager_->Init();
     apnManager_->InitApnHolders();
     dataSwitchSettings_->LoadSwitchValue();
+    RefreshRadioContext();
     GetConfigurationFor5G();
     SetRilLinkBandwidths();
+    SendEvent(CellularDataEventCode::MSG_WARM_UP_CONNECTION_POOL);
 }
 
 CellularDataHandler::~CellularDataHandler() {}
@@ -95,13 +100,20 @@ bool CellularDataHandler::ReleaseNet(const NetRequest &request)
     netRequest->capability = ApnManager::FindBestCapability(request.capability);
     netRequest->ident = request.ident;
     netRequest->bearTypes = request.bearTypes;
+    int32_t apnId = ApnManager::FindApnIdByCapability(netRequest->capability);
+    if (!pendingIntents_.AddNetRequest(apnId, netRequest->ident, TYPE_RELEASE_NET, netRequest->bearTypes)) {
+        TELEPHONY_LOGI("Slot%{public}d: release of apnId %{public}d is pending", slotId_, apnId);
+        return true;
+    }
+    std::string ident = netRequest->ident;
     AppExecFwk::InnerEvent::Pointer event =
         InnerEvent::Get(CellularDataEventCode::MSG_REQUEST_NETWORK, netRequest, TYPE_RELEASE_NET);
-    if (event == nullptr) {
-        TELEPHONY_LOGE("event is null");
+    if (event == nullptr || !SendEvent(event)) {
+        TELEPHONY_LOGE("send release event failed");
+        pendingIntents_.FinishNetRequest(apnId, ident, TYPE_RELEASE_NET);
         return false;
     }
-    return SendEvent(event);
+    return true;
 }
 
 bool CellularDataHandler::RequestNet(const NetRequest &request)
@@ -120,9 +132,19 @@ bool CellularDataHandler::RequestNet(const NetRequest &request)
     netRequest->capability = ApnManager::FindBestCapability(request.capability);
     netRequest->ident = request.ident;
     netRequest->bearTypes = request.bearTypes;
+    int32_t apnId = ApnManager::FindApnIdByCapability(netRequest->capability);
+    if (!pendingIntents_.AddNetRequest(apnId, netRequest->ident, TYPE_REQUEST_NET, netRequest->bearTypes)) {
+        TELEPHONY_LOGI("Slot%{public}d: request of apnId %{public}d is pending", slotId_, apnId);
+        return true;
+    }
+    std::string ident = netRequest->ident;
     AppExecFwk::InnerEvent::Pointer event =
         InnerEvent::Get(CellularDataEventCode::MSG_REQUEST_NETWORK, netRequest, TYPE_REQUEST_NET);
-    return SendEvent(event);
+    if (!SendEvent(event)) {
+        pendingIntents_.FinishNetRequest(apnId, ident, TYPE_REQUEST_NET);
+        return false;
+    }
+    return true;
 }
 
 __attribute__((no_sanitize("cfi")))
@@ -250,6 +272,8 @@ static int32_t DeactivatePdpAfterHandover(const int32_t& slotId)
 
 void CellularDataHandler::ClearAllConnections(DisConnectionReason reason)
 {
+    // nothing is activating any more, a holder still marked as waiting would be skipped for good
+    waitingApnIds_.clear();
     if (isHandoverOccurred_) {
         int32_t result = DeactivatePdpAfterHandover(slotId_);
         if (result != TELEPHONY_ERR_SUCCESS) {
@@ -310,6 +334,56 @@ void CellularDataHandler::ClearConnectionsOnUpdateApns(DisConnectionReason reaso
     }
 }
 
+void CellularDataHandler::ClearChangedConnectionsOnUpdateApns(DisConnectionReason reason)
+{
+    if (apnManager_ == nullptr) {
+        TELEPHONY_LOGE("Slot%{public}d: apnManager is null", slotId_);
+        return;
+    }
+    bool isRoaming = false;
+    int32_t result = IsCellularDataRoamingEnabled(isRoaming);
+    if (result != TELEPHONY_ERR_SUCCESS) {
+        isRoaming = false;
+    }
+    auto attachApn = apnManager_->GetRilAttachApn();
+    if (attachApn != nullptr) {
+        TELEPHONY_LOGI("update preferId=%{public}d", attachApn->attr_.profileId_);
+        UpdateApnInfo(attachApn->attr_.profileId_);
+    }
+    // a new attach or preferred apn moves the default bearer, so everything is rebuilt as before
+    if (!ApnHolder::IsCompatibleApnItem(lastApnItem_, attachApn, isRoaming)) {
+        ClearAllConnections(reason);
+        if (lastApnItem_ == nullptr) {
+            lastApnItem_ = new ApnItem();
+        }
+        if (attachApn == nullptr) {
+            return;
+        }
+        *lastApnItem_ = *attachApn;
+        return;
+    }
+    // only connections whose apn was removed or edited incompatibly are torn down, others keep their bearer
+    for (const sptr<ApnHolder> &apnHolder : apnManager_->GetAllApnHolder()) {
+        if (apnHolder == nullptr || apnHolder->GetApnState() == PROFILE_STATE_IDLE) {
+            continue;
+        }
+        sptr<ApnItem> currentApn = apnHolder->GetCurrentApn();
+        if (currentApn == nullptr) {
+            continue;
+        }
+        sptr<ApnItem> newApn = apnManager_->GetApnItemById(currentApn->attr_.profileId_);
+        if (ApnHolder::IsCompatibleApnItem(newApn, currentApn, isRoaming)) {
+            if (!ApnHolder::IsSameApnItem(newApn, currentApn, isRoaming)) {
+                apnHolder->SetCurrentApn(newApn);
+            }
+            continue;
+        }
+        TELEPHONY_LOGI("Slot%{public}d: apn of %{public}s changed, profileId:%{public}d", slotId_,
+            apnHolder->GetApnType().c_str(), currentApn->attr_.profileId_);
+        ClearConnection(apnHolder, reason);
+    }
+}
+
 void CellularDataHandler::ResetDataFlowType()
 {
     if (dataSwitchSettings_ == nullptr) {
@@ -391,9 +465,18 @@ void CellularDataHandler::RadioPsConnectionAttached(const InnerEvent::Pointer &e
     }
     // LCOV_EXCL_STOP
     isMccChanged_ = false;
+    pdnBringUpPending_ = true;
+    pdnBringUpBeginTime_ = std::chrono::steady_clock::now();
     EstablishAllApnsIfConnectable();
 }
 
+void CellularDataHandler::RadioPsConnectionDetached(const InnerEvent::Pointer &event)
+{
+    TELEPHONY_LOGI("Slot%{public}d: ps detached", slotId_);
+    // apns still coming up will not connect before the next attach restarts the measurement
+    pdnBringUpPending_ = false;
+}
+
 void CellularDataHandler::RoamingStateOn(const InnerEvent::Pointer &event)
 {
     TELEPHONY_LOGI("Slot%{public}d: roaming on", slotId_);
@@ -584,9 +667,9 @@ bool CellularDataHandler::CheckAttachAndSimState(sptr<ApnHolder> &apnHolder)
     if (isMccChanged_) {
         return false;
     }
-    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
-    bool attached = coreInner.GetPsRegState(slotId_) == (int32_t)RegServiceState::REG_STATE_IN_SERVICE;
-    bool isSimStateReadyOrLoaded = IsSimStateReadyOrLoaded();
+    std::shared_ptr<const RadioContextSnapshot> radioContext = GetRadioContext();
+    bool attached = radioContext->IsPsAttached();
+    bool isSimStateReadyOrLoaded = radioContext->IsSimStateReadyOrLoaded();
     TELEPHONY_LOGD("Slot%{public}d: attached: %{public}d simState: %{public}d isRilApnAttached: %{public}d",
         slotId_, attached, isSimStateReadyOrLoaded, isRilApnAttached_);
     if (apnHolder->IsMmsType() && isSimStateReadyOrLoaded && !attached) {
@@ -617,12 +700,11 @@ bool CellularDataHandler::CheckRoamingState(sptr<ApnHolder> &apnHolder)
     if (IsVSimSlotId(slotId_)) {
         return true;
     }
-    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
     bool isEmergencyApn = apnHolder->IsEmergencyType();
     bool isMmsApn = apnHolder->IsMmsType();
     bool isBipApn = apnHolder->IsBipType();
     bool isAllowActiveData = dataSwitchSettings_->IsAllowActiveData();
-    bool roamingState = coreInner.GetPsRoamingState(slotId_) > 0;
+    bool roamingState = GetRadioContext()->psRoaming;
     bool dataRoamingEnabled = dataSwitchSettings_->IsUserDataRoamingOn();
     if (roamingState && !dataRoamingEnabled) {
         isAllowActiveData = false;
@@ -669,7 +751,7 @@ bool CellularDataHandler::CheckApnState(sptr<ApnHolder> &apnHolder)
         !HasInnerEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION)) {
         TELEPHONY_LOGI("Slot%{public}d: APN holder is disconnecting", slotId_);
         int32_t id = apnManager_->FindApnIdByApnName(apnHolder->GetApnType());
-        SendEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION, id, ESTABLISH_DATA_CONNECTION_DELAY);
+        SendEstablishEvent(id, ESTABLISH_DATA_CONNECTION_DELAY);
         return false;
     }
     if (apnHolder->GetApnState() == PROFILE_STATE_RETRYING) {
@@ -750,12 +832,12 @@ void CellularDataHandler::AttemptEstablishDataConnection(sptr<ApnHolder> &apnHol
         FinishTrace(HITRACE_TAG_OHOS);
         return;
     }
+    DataSetupTimeline::Mark(slotId_, ApnManager::FindApnIdByApnName(apnHolder->GetApnType()),
+        SetupStage::ATTEMPT_CHECKS_PASSED);
     if (CheckMultiApnState(apnHolder)) {
         TELEPHONY_LOGE("Slot%{public}d: bip or dun is using", slotId_);
     }
-    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
-    int32_t radioTech = static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_INVALID);
-    coreInner.GetPsRadioTech(slotId_, radioTech);
+    int32_t radioTech = GetRadioContext()->psRadioTech;
     if (!EstablishDataConnection(apnHolder, radioTech)) {
         TELEPHONY_LOGE("Slot%{public}d: Establish data connection fail", slotId_);
     } else {
@@ -795,6 +877,60 @@ std::shared_ptr<CellularDataStateMachine> CellularDataHandler::CreateCellularDat
     return cellularDataStateMachine;
 }
 
+std::shared_ptr<CellularDataStateMachine> CellularDataHandler::AcquireCellularDataConnect()
+{
+    {
+        std::lock_guard<std::mutex> lock(connectionPoolMutex_);
+        if (!connectionPool_.empty()) {
+            std::shared_ptr<CellularDataStateMachine> cellularDataStateMachine = connectionPool_.back();
+            connectionPool_.pop_back();
+            return cellularDataStateMachine;
+        }
+    }
+    std::shared_ptr<CellularDataStateMachine> cellularDataStateMachine = CreateCellularDataConnect();
+    if (cellularDataStateMachine != nullptr) {
+        cellularDataStateMachine->Init();
+    }
+    return cellularDataStateMachine;
+}
+
+void CellularDataHandler::WarmUpConnectionPool()
+{
+    if (connectionManager_ == nullptr) {
+        TELEPHONY_LOGE("Slot%{public}d: connectionManager_ is null", slotId_);
+        return;
+    }
+    size_t created = connectionManager_->GetAllConnectionMachine().size();
+    std::lock_guard<std::mutex> lock(connectionPoolMutex_);
+    while (created + connectionPool_.size() < CONNECTION_POOL_SIZE) {
+        std::shared_ptr<CellularDataStateMachine> cellularDataStateMachine = CreateCellularDataConnect();
+        if (cellularDataStateMachine == nullptr) {
+            break;
+        }
+        cellularDataStateMachine->Init();
+        connectionPool_.push_back(cellularDataStateMachine);
+    }
+    TELEPHONY_LOGI("Slot%{public}d: connection pool size %{public}zu, in use %{public}zu", slotId_,
+        connectionPool_.size(), created);
+}
+
+void CellularDataHandler::DrainConnectionPool()
+{
+    RemoveEvent(CellularDataEventCode::MSG_WARM_UP_CONNECTION_POOL);
+    std::vector<std::shared_ptr<CellularDataStateMachine>> connectionPool;
+    {
+        std::lock_guard<std::mutex> lock(connectionPoolMutex_);
+        connectionPool.swap(connectionPool_);
+    }
+    // pooled machines hold the handler, they are released here rather than with it
+    for (const std::shared_ptr<CellularDataStateMachine> &stateMachine : connectionPool) {
+        if (stateMachine != nullptr) {
+            stateMachine->UnregisterNetInterfaceCallback();
+        }
+    }
+    TELEPHONY_LOGI("Slot%{public}d: drain %{public}zu pooled connections", slotId_, connectionPool.size());
+}
+
 bool CellularDataHandler::EstablishDataConnection(sptr<ApnHolder> &apnHolder, int32_t radioTech)
 {
     int32_t profileId = GetCurrentApnId();
@@ -834,12 +970,11 @@ bool CellularDataHandler::EstablishDataConnection(sptr<ApnHolder> &apnHolder, in
         }
         cellularDataStateMachine = FindIdleCellularDataConnection();
         if (cellularDataStateMachine == nullptr) {
-            cellularDataStateMachine = CreateCellularDataConnect();
+            cellularDataStateMachine = AcquireCellularDataConnect();
             if (cellularDataStateMachine == nullptr) {
                 TELEPHONY_LOGE("Slot%{public}d: cellularDataStateMachine is null", slotId_);
                 return false;
             }
-            cellularDataStateMachine->Init();
             if (connectionManager_ == nullptr) {
                 TELEPHONY_LOGE("Slot%{public}d: connectionManager_ is null", slotId_);
                 return false;
@@ -855,7 +990,7 @@ bool CellularDataHandler::EstablishDataConnection(sptr<ApnHolder> &apnHolder, in
     CellularDataHiSysEvent::WriteDataConnectStateBehaviorEvent(slotId_, apnHolder->GetApnType(),
         apnHolder->GetCapability(), static_cast<int32_t>(PROFILE_STATE_CONNECTING));
     apnHolder->SetCellularDataStateMachine(cellularDataStateMachine);
-    bool roamingState = CoreManagerInner::GetInstance().GetPsRoamingState(slotId_) > 0;
+    bool roamingState = GetRadioContext()->psRoaming;
     bool userDataRoaming = dataSwitchSettings_->IsUserDataRoamingOn();
     UpdateCellularDataConnectState(apnHolder->GetApnType());
     std::unique_ptr<DataConnectionParams> object = std::make_unique<DataConnectionParams>(
@@ -886,7 +1021,13 @@ bool CellularDataHandler::HandleCompatibleDataConnection(
         stateMachine->SetIfReuseSupplierId(true);
         return true;
     }
-    SendEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION, newApnId, ESTABLISH_DATA_CONNECTION_DELAY);
+    if (!IsSingleConnectionEnabled(GetRadioContext()->psRadioTech)) {
+        // served by EstablishWaitingConnections or re-queued on failure instead of polling the activation
+        TELEPHONY_LOGI("Slot%{public}d: apnId[%{public}d] waits for apnId[%{public}d]", slotId_, newApnId, oldApnId);
+        waitingApnIds_.insert(newApnId);
+        return false;
+    }
+    SendEstablishEvent(newApnId, ESTABLISH_DATA_CONNECTION_DELAY);
     return false;
 }
 
@@ -910,11 +1051,15 @@ void CellularDataHandler::EstablishDataConnectionComplete(const InnerEvent::Poin
         CellularDataHiSysEvent::WriteDataConnectStateBehaviorEvent(slotId_, apnHolder->GetApnType(),
             apnHolder->GetCapability(), static_cast<int32_t>(PROFILE_STATE_CONNECTED));
         apnHolder->InitialApnRetryCount();
+        RecordPdnBringUpIfDone();
         if (apnHolder->GetApnType() == DATA_CONTEXT_ROLE_DEFAULT) {
             HILOG_COMM_IMPL(LOG_INFO, LOG_DOMAIN, TELEPHONY_LOG_TAG,
                 "default apn has connected, to setup internal_default apn");
             SendEvent(CellularDataEventCode::MSG_RETRY_TO_SETUP_DATACALL, DATA_CONTEXT_ROLE_INTERNAL_DEFAULT_ID, 0);
         }
+        if (!IsSingleConnectionEnabled(GetRadioContext()->psRadioTech)) {
+            EstablishWaitingConnections(apnHolder);
+        }
         DataConnCompleteUpdateState(apnHolder, resultInfo);
     }
 }
@@ -1102,6 +1247,7 @@ void CellularDataHandler::DisconnectDataComplete(const InnerEvent::Pointer &even
 #endif
     }
     HandleIncallDataDisconnectComplete();
+    EstablishBlockedConnections();
     if (reason == DisConnectionReason::REASON_CHANGE_CONNECTION) {
         HandleSortConnection();
     }
@@ -1183,7 +1329,7 @@ void CellularDataHandler::RetryToSetupDatacall(const AppExecFwk::InnerEvent::Poi
     }
     TELEPHONY_LOGI("apnId=%{public}d, state=%{public}d", apnId, apnHolder->GetApnState());
     apnHolder->SetApnState(PROFILE_STATE_IDLE);
-    SendEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION, apnId, 0);
+    SendEstablishEvent(apnId, 0);
 }
 
 void CellularDataHandler::UpdatePhysicalConnectionState(bool noActiveConnection)
@@ -1201,18 +1347,95 @@ void CellularDataHandler::HandleSortConnection()
 {
     ApnProfileState state = apnManager_->GetOverallApnState();
     if (state == PROFILE_STATE_IDLE || state == PROFILE_STATE_FAILED) {
+        bool singleConnection = IsSingleConnectionEnabled(GetRadioContext()->psRadioTech);
         for (const sptr<ApnHolder> &sortApnHolder : apnManager_->GetSortApnHolder()) {
-            if (sortApnHolder->IsDataCallEnabled()) {
-                int32_t apnId = apnManager_->FindApnIdByApnName(sortApnHolder->GetApnType());
+            if (sortApnHolder == nullptr || !sortApnHolder->IsDataCallEnabled()) {
+                continue;
+            }
+            int32_t apnId = apnManager_->FindApnIdByApnName(sortApnHolder->GetApnType());
+            // retrying and waiting holders are served when their block clears, queueing them would only poll
+            if (IsReadyToEstablish(sortApnHolder) && waitingApnIds_.count(apnId) == 0) {
                 TELEPHONY_LOGI("Slot%{public}d: HandleSortConnection the apn type is %{public}s", slotId_,
                     sortApnHolder->GetApnType().c_str());
-                SendEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION, apnId, 0);
+                SendEstablishEvent(apnId, 0);
+            }
+            // with a single pdp the highest priority enabled holder blocks all lower ones
+            if (singleConnection) {
                 break;
             }
         }
     }
 }
 
+void CellularDataHandler::EstablishWaitingConnections(const sptr<ApnHolder> &connectedApnHolder)
+{
+    std::shared_ptr<CellularDataStateMachine> stateMachine = connectedApnHolder->GetCellularDataStateMachine();
+    if (stateMachine == nullptr || stateMachine->GetApnItem() == nullptr) {
+        return;
+    }
+    sptr<ApnItem> apnItem = stateMachine->GetApnItem();
+    for (const sptr<ApnHolder> &sortApnHolder : apnManager_->GetSortApnHolder()) {
+        if (sortApnHolder == nullptr || sortApnHolder == connectedApnHolder || !sortApnHolder->IsDataCallEnabled() ||
+            !IsReadyToEstablish(sortApnHolder) || sortApnHolder->GetApnType() == DATA_CONTEXT_ROLE_INTERNAL_DEFAULT) {
+            continue;
+        }
+        // holders that were waiting on this activation are served now instead of at the next poll
+        if (apnItem->CanDealWithType(sortApnHolder->GetApnType())) {
+            TELEPHONY_LOGI("Slot%{public}d: %{public}s connected, to setup %{public}s", slotId_,
+                connectedApnHolder->GetApnType().c_str(), sortApnHolder->GetApnType().c_str());
+            int32_t apnId = ApnManager::FindApnIdByApnName(sortApnHolder->GetApnType());
+            waitingApnIds_.erase(apnId);
+            SendEstablishEvent(apnId, 0);
+        }
+    }
+}
+
+void CellularDataHandler::EstablishBlockedConnections()
+{
+    if (waitingApnIds_.empty() || apnManager_ == nullptr) {
+        return;
+    }
+    std::set<int32_t> waitingApnIds;
+    waitingApnIds.swap(waitingApnIds_);
+    for (int32_t apnId : waitingApnIds) {
+        sptr<ApnHolder> apnHolder = apnManager_->FindApnHolderById(apnId);
+        if (apnHolder == nullptr || !apnHolder->IsDataCallEnabled() || !IsReadyToEstablish(apnHolder)) {
+            continue;
+        }
+        // the activation it waited on is gone, let it set up its own connection
+        SendEstablishEvent(apnId, 0);
+    }
+}
+
+bool CellularDataHandler::IsReadyToEstablish(const sptr<ApnHolder> &apnHolder) const
+{
+    ApnProfileState apnState = apnHolder->GetApnState();
+    return apnState == PROFILE_STATE_IDLE || apnState == PROFILE_STATE_FAILED;
+}
+
+void CellularDataHandler::RecordPdnBringUpIfDone()
+{
+    if (!pdnBringUpPending_ || apnManager_ == nullptr) {
+        return;
+    }
+    uint32_t connectedCount = 0;
+    for (const sptr<ApnHolder> &apnHolder : apnManager_->GetSortApnHolder()) {
+        if (apnHolder == nullptr || !apnHolder->IsDataCallEnabled()) {
+            continue;
+        }
+        if (apnHolder->GetApnState() != PROFILE_STATE_CONNECTED) {
+            return;
+        }
+        connectedCount++;
+    }
+    pdnBringUpPending_ = false;
+    int64_t bringUpUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - pdnBringUpBeginTime_).count();
+    TELEPHONY_LOGI("Slot%{public}d: %{public}u apns up %{public}lld us after attach", slotId_, connectedCount,
+        static_cast<long long>(bringUpUs));
+    CellularDataPerfStats::RecordPdnBringUp(slotId_, connectedCount, bringUpUs);
+}
+
 static void FindDisConnectionReason(DisConnectionReason& reason, const std::unique_ptr<uint64_t>& disconnectBearType,
                                     const std::string& apnType)
 {
@@ -1236,6 +1459,7 @@ void CellularDataHandler::MsgEstablishDataConnection(const InnerEvent::Pointer &
         TELEPHONY_LOGE("Slot%{public}d: apnManager_ or event is null", slotId_);
         return;
     }
+    pendingIntents_.FinishEstablish(event->GetParam());
     sptr<ApnHolder> apnHolder = apnManager_->FindApnHolderById(event->GetParam());
     if (apnHolder == nullptr) {
         TELEPHONY_LOGE("Slot%{public}d: apnHolder is null", slotId_);
@@ -1243,6 +1467,7 @@ void CellularDataHandler::MsgEstablishDataConnection(const InnerEvent::Pointer &
     }
     TELEPHONY_LOGI("Slot%{public}d: APN holder type:%{public}s call:%{public}d", slotId_,
         apnHolder->GetApnType().c_str(), apnHolder->IsDataCallEnabled());
+    DataSetupTimeline::Mark(slotId_, event->GetParam(), SetupStage::MSG_ESTABLISH_DATA_CONNECTION);
     bool isCardAllowData = true;
     int32_t simId = CoreManagerInner::GetInstance().GetSimId(slotId_);
     // LCOV_EXCL_START
@@ -1252,8 +1477,16 @@ void CellularDataHandler::MsgEstablishDataConnection(const InnerEvent::Pointer &
     }
     // LCOV_EXCL_STOP
     if (isCardAllowData && apnHolder->IsDataCallEnabled()) {
+        ApnProfileState apnState = apnHolder->GetApnState();
+        if (apnState == PROFILE_STATE_CONNECTING || apnState == PROFILE_STATE_CONNECTED) {
+            // the attempt would stop at CheckApnState, skip the checks before it
+            pendingIntents_.AddCoalescedCount();
+            return;
+        }
+        pendingIntents_.AddExecutedCount();
         AttemptEstablishDataConnection(apnHolder);
     } else {
+        pendingIntents_.AddExecutedCount();
         TELEPHONY_LOGI("Slot%{public}d, MsgEstablishDataConnection IsDataCallEnabled is false,"
             "apnType: %{public}s", slotId_, apnHolder->GetApnType().c_str());
         DisConnectionReason reason = DisConnectionReason::REASON_CHANGE_CONNECTION;
@@ -1353,13 +1586,29 @@ void CellularDataHandler::SetNetRequest(NetRequest &request, const std::unique_p
 
 void CellularDataHandler::SendEstablishDataConnectionEvent(int32_t id, uint64_t disconnectBearType)
 {
+    pendingIntents_.AddEstablish(id, 0, true);
     InnerEvent::Pointer innerEvent = InnerEvent::Get(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION, id,
                                                      std::make_unique<uint64_t>(disconnectBearType));
     if (!SendEvent(innerEvent)) {
         TELEPHONY_LOGE("Slot%{public}d: send data connection event failed", slotId_);
+        pendingIntents_.FinishEstablish(id);
     }
 }
 
+bool CellularDataHandler::SendEstablishEvent(int32_t apnId, int64_t delayTime)
+{
+    if (!pendingIntents_.AddEstablish(apnId, delayTime)) {
+        TELEPHONY_LOGD("Slot%{public}d: establish of apnId %{public}d is pending", slotId_, apnId);
+        return true;
+    }
+    if (!SendEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION, apnId, delayTime)) {
+        TELEPHONY_LOGE("Slot%{public}d: send establish event failed", slotId_);
+        pendingIntents_.FinishEstablish(apnId);
+        return false;
+    }
+    return true;
+}
+
 #ifdef BASE_POWER_IMPROVEMENT
 void CellularDataHandler::SubscribeTelePowerEvent()
 {
@@ -1396,6 +1645,8 @@ void CellularDataHandler::MsgRequestNetwork(const InnerEvent::Pointer &event)
     NetRequest request;
     SetNetRequest(request, netRequest);
     int32_t id = ApnManager::FindApnIdByCapability(request.capability);
+    pendingIntents_.FinishNetRequest(id, request.ident, static_cast<int32_t>(event->GetParam()));
+    pendingIntents_.AddExecutedCount();
     sptr<ApnHolder> apnHolder = apnManager_->FindApnHolderById(id);
     if (apnHolder == nullptr) {
         TELEPHONY_LOGE("Slot%{public}d: apnHolder is null.", slotId_);
@@ -1403,11 +1654,13 @@ void CellularDataHandler::MsgRequestNetwork(const InnerEvent::Pointer &event)
     }
 
     if (event->GetParam() == TYPE_REQUEST_NET) {
+        DataSetupTimeline::Mark(slotId_, id, SetupStage::MSG_REQUEST_NETWORK);
         apnHolder->RequestCellularData(request);
 #ifdef OHOS_BUILD_ENABLE_TELEPHONY_EXT
         NotifyReqCellularData(true);
 #endif
     } else {
+        DataSetupTimeline::Abort(slotId_, id);
         apnHolder->ReleaseAllCellularData();
 #ifdef OHOS_BUILD_ENABLE_TELEPHONY_EXT
         NotifyReqCellularData(false);
@@ -1422,10 +1675,63 @@ void CellularDataHandler::ProcessEvent(const InnerEvent::Pointer &event)
         TELEPHONY_LOGE("Slot%{public}d: event is null!", slotId_);
         return;
     }
+    CellularDataPerfScope perfScope(PerfComponent::HANDLER, slotId_, event);
     uint32_t eventCode = event->GetInnerEventId();
-    std::map<uint32_t, Fun>::iterator it = eventIdMap_.find(eventCode);
-    if (it != eventIdMap_.end()) {
-        it->second(event);
+    if (IsRadioContextEvent(eventCode)) {
+        RefreshRadioContext();
+    }
+    DispatchEvent(eventCode, event);
+}
+
+void CellularDataHandler::DispatchEvent(uint32_t eventCode, const InnerEvent::Pointer &event)
+{
+    using Self = CellularDataHandler;
+    static constexpr auto dispatchTable = MakeEventDispatchTable<Self, void>({
+        { RadioEvent::RADIO_PS_CONNECTION_ATTACHED, &Self::RadioPsConnectionAttached },
+        { RadioEvent::RADIO_PS_CONNECTION_DETACHED, &Self::RadioPsConnectionDetached },
+        { RadioEvent::RADIO_PS_ROAMING_OPEN, &Self::RoamingStateOn },
+        { RadioEvent::RADIO_PS_ROAMING_CLOSE, &Self::RoamingStateOff },
+        { RadioEvent::RADIO_EMERGENCY_STATE_OPEN, &Self::PsRadioEmergencyStateOpen },
+        { RadioEvent::RADIO_EMERGENCY_STATE_CLOSE, &Self::PsRadioEmergencyStateClose },
+        { CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION_COMPLETE, &Self::EstablishDataConnectionComplete },
+        { CellularDataEventCode::MSG_DISCONNECT_DATA_COMPLETE, &Self::DisconnectDataComplete },
+        { CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION, &Self::MsgEstablishDataConnection },
+        { CellularDataEventCode::MSG_SETTING_SWITCH, &Self::HandleSettingSwitchChanged },
+        { CellularDataEventCode::MSG_REQUEST_NETWORK, &Self::MsgRequestNetwork },
+        { RadioEvent::RADIO_STATE_CHANGED, &Self::HandleRadioStateChanged },
+        { RadioEvent::RADIO_DSDS_MODE_CHANGED, &Self::HandleDsdsModeChanged },
+        { RadioEvent::RADIO_SIM_STATE_CHANGE, &Self::HandleSimEvent },
+        { RadioEvent::RADIO_SIM_RECORDS_LOADED, &Self::HandleSimEvent },
+        { RadioEvent::RADIO_SIM_ACCOUNT_LOADED, &Self::HandleSimEvent },
+        { RadioEvent::RADIO_PS_RAT_CHANGED, &Self::PsDataRatChanged },
+        { CellularDataEventCode::MSG_APN_CHANGED, &Self::HandleApnChanged },
+        { CellularDataEventCode::MSG_SET_RIL_ATTACH_APN, &Self::SetRilAttachApnResponse },
+        { RadioEvent::RADIO_NR_STATE_CHANGED, &Self::HandleRadioNrStateChanged },
+        { RadioEvent::RADIO_NR_FREQUENCY_CHANGED, &Self::HandleRadioNrFrequencyChanged },
+        { CellularDataEventCode::MSG_DB_SETTING_ENABLE_CHANGED, &Self::HandleDBSettingEnableChanged },
+        { CellularDataEventCode::MSG_DB_SETTING_ROAMING_CHANGED, &Self::HandleDBSettingRoamingChanged },
+        { CellularDataEventCode::MSG_DB_SETTING_INCALL_CHANGED, &Self::HandleDBSettingIncallChanged },
+        { CellularDataEventCode::MSG_INCALL_DATA_COMPLETE, &Self::IncallDataComplete },
+        { RadioEvent::RADIO_RIL_ADAPTER_HOST_DIED, &Self::OnRilAdapterHostDied },
+        { RadioEvent::RADIO_FACTORY_RESET, &Self::HandleFactoryReset },
+        { RadioEvent::RADIO_CLEAN_ALL_DATA_CONNECTIONS, &Self::OnCleanAllDataConnectionsDone },
+        { CellularDataEventCode::MSG_DATA_CALL_LIST_CHANGED, &Self::HandleUpdateNetInfo },
+        { RadioEvent::RADIO_NV_REFRESH_FINISHED, &Self::HandleSimEvent },
+        { CellularDataEventCode::MSG_RETRY_TO_SETUP_DATACALL, &Self::RetryToSetupDatacall },
+        { CellularDataEventCode::MSG_ESTABLISH_ALL_APNS_IF_CONNECTABLE, &Self::HandleEstablishAllApnsIfConnectable },
+        { CellularDataEventCode::MSG_RESUME_DATA_PERMITTED_TIMEOUT, &Self::ResumeDataPermittedTimerOut },
+        { CellularDataEventCode::MSG_RETRY_TO_CREATE_APN, &Self::HandleApnChanged },
+        { CellularDataEventCode::MSG_RETRY_TO_LOAD_SIM_ACCOUNT, &Self::HandleRetryLoadSimAccount },
+        { RadioEvent::RADIO_RESIDENT_NETWORK_CHANGE, &Self::HandleResidentNetworkChanged },
+        { CellularDataEventCode::MSG_MCC_CHANGE_ACTIVATE_DELAY, &Self::HandleMccChangeDelay },
+        { CellularDataEventCode::MSG_WARM_UP_CONNECTION_POOL, &Self::HandleWarmUpConnectionPool },
+#ifdef BASE_POWER_IMPROVEMENT
+        { CellularDataEventCode::MSG_TIMEOUT_TO_REPLY_COMMON_EVENT, &Self::HandleReplyCommonEvent },
+#endif
+    });
+    auto handler = dispatchTable.Find(eventCode);
+    if (handler != nullptr) {
+        (this->*handler)(event);
     }
 }
 
@@ -1480,16 +1786,53 @@ void CellularDataHandler::HandleScreenStateChanged(bool isScreenOn) const
 
 bool CellularDataHandler::IsSimStateReadyOrLoaded()
 {
-    SimState simState = SimState::SIM_STATE_UNKNOWN;
-    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
-    coreInner.GetSimState(slotId_, simState);
-    return (simState == SimState::SIM_STATE_READY || simState == SimState::SIM_STATE_LOADED);
+    return GetRadioContext()->IsSimStateReadyOrLoaded();
+}
+
+bool CellularDataHandler::IsRadioContextEvent(uint32_t eventCode) const
+{
+    switch (eventCode) {
+        case RadioEvent::RADIO_PS_CONNECTION_ATTACHED:
+        case RadioEvent::RADIO_PS_CONNECTION_DETACHED:
+        case RadioEvent::RADIO_PS_ROAMING_OPEN:
+        case RadioEvent::RADIO_PS_ROAMING_CLOSE:
+        case RadioEvent::RADIO_PS_RAT_CHANGED:
+        case RadioEvent::RADIO_NR_STATE_CHANGED:
+        case RadioEvent::RADIO_NR_FREQUENCY_CHANGED:
+        case RadioEvent::RADIO_SIM_STATE_CHANGE:
+        case RadioEvent::RADIO_SIM_RECORDS_LOADED:
+        case RadioEvent::RADIO_STATE_CHANGED:
+        case RadioEvent::RADIO_RESIDENT_NETWORK_CHANGE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::shared_ptr<const RadioContextSnapshot> CellularDataHandler::GetRadioContext() const
+{
+    std::lock_guard<std::mutex> lock(radioContextMutex_);
+    if (radioContext_ == nullptr) {
+        radioContext_ = RadioContextSnapshot::Capture(slotId_);
+    }
+    return radioContext_;
+}
+
+void CellularDataHandler::RefreshRadioContext()
+{
+    std::shared_ptr<const RadioContextSnapshot> radioContext = RadioContextSnapshot::Capture(slotId_);
+    {
+        std::lock_guard<std::mutex> lock(radioContextMutex_);
+        radioContext_ = radioContext;
+    }
+    if (connectionManager_ != nullptr) {
+        connectionManager_->SetRadioContext(radioContext);
+    }
 }
 
 void CellularDataHandler::UpdateCellularDataConnectState(const std::string &apnType)
 {
-    int32_t networkType = static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_INVALID);
-    CoreManagerInner::GetInstance().GetPsRadioTech(slotId_, networkType);
+    int32_t networkType = GetRadioContext()->psRadioTech;
     if (apnType == DATA_CONTEXT_ROLE_DEFAULT || apnType == DATA_CONTEXT_ROLE_INTERNAL_DEFAULT) {
         ApnProfileState apnState = apnManager_->GetOverallDefaultApnState();
         StateNotification::GetInstance().UpdateCellularDataConnectState(slotId_, apnState, networkType);
@@ -1674,6 +2017,9 @@ void CellularDataHandler::HandleSimStateChanged()
     CoreManagerInner::GetInstance().GetSimState(slotId_, simState);
     TELEPHONY_LOGI("Slot%{public}d: sim state is :%{public}d", slotId_, simState);
     if (simState == SimState::SIM_STATE_READY) {
+        // refill the pool drained on sim removal before the records loaded establishment
+        RemoveEvent(CellularDataEventCode::MSG_WARM_UP_CONNECTION_POOL);
+        SendEvent(CellularDataEventCode::MSG_WARM_UP_CONNECTION_POOL);
         std::u16string iccId;
         CoreManagerInner::GetInstance().GetSimIccId(slotId_, iccId);
         if (lastIccId_ != u"" && lastIccId_ == iccId) {
@@ -1687,6 +2033,12 @@ void CellularDataHandler::HandleSimStateChanged()
             CellularDataNetAgent::GetInstance().UnregisterNetSupplierForSimUpdate(slotId_);
             ReleaseAllNetworkRequest();
             UnRegisterDataSettingObserver();
+            DrainConnectionPool();
+            waitingApnIds_.clear();
+            pdnBringUpPending_ = false;
+            // queued establishments are useless without the sim, drop them with their pending intents
+            RemoveEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION);
+            pendingIntents_.Clear();
         }
     }
 }
@@ -1753,6 +2105,14 @@ void CellularDataHandler::HandleEstablishAllApnsIfConnectable(const AppExecFwk::
     EstablishAllApnsIfConnectable();
 }
 
+void CellularDataHandler::HandleWarmUpConnectionPool(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (event == nullptr) {
+        return;
+    }
+    WarmUpConnectionPool();
+}
+
 void CellularDataHandler::ReportEventToChr(int32_t slotId, const char* scenario, int32_t cause)
 {
     #ifdef OHOS_BUILD_ENABLE_TELEPHONY_EXT
@@ -1913,7 +2273,7 @@ void CellularDataHandler::HandleApnChanged(const InnerEvent::Pointer &event)
     }
     CreateApnItem();
     SetRilAttachApn();
-    ClearConnectionsOnUpdateApns(DisConnectionReason::REASON_CLEAR_CONNECTION);
+    ClearChangedConnectionsOnUpdateApns(DisConnectionReason::REASON_CLEAR_CONNECTION);
     apnManager_->ClearAllApnBad();
     for (const sptr<ApnHolder> &apnHolder : apnManager_->GetAllApnHolder()) {
         if (apnHolder == nullptr) {
@@ -1925,7 +2285,7 @@ void CellularDataHandler::HandleApnChanged(const InnerEvent::Pointer &event)
             apnHolder->SetApnState(PROFILE_STATE_IDLE);
             RemoveEvent(CellularDataEventCode::MSG_RETRY_TO_SETUP_DATACALL);
         }
-        SendEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION, id, ESTABLISH_DATA_CONNECTION_DELAY);
+        SendEstablishEvent(id, ESTABLISH_DATA_CONNECTION_DELAY);
     }
 }
 
@@ -2109,8 +2469,7 @@ void CellularDataHandler::SetPolicyDataOn(bool enable)
 
 bool CellularDataHandler::IsRestrictedMode() const
 {
-    int32_t networkType = static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_INVALID);
-    CoreManagerInner::GetInstance().GetPsRadioTech(slotId_, networkType);
+    int32_t networkType = GetRadioContext()->psRadioTech;
     bool support = (networkType == (int32_t)RadioTech::RADIO_TECHNOLOGY_GSM);
     bool inCall = (lastCallState_ != TelCallStatus::CALL_STATUS_IDLE &&
                    lastCallState_ != TelCallStatus::CALL_STATUS_DISCONNECTED);
@@ -2541,6 +2900,7 @@ void CellularDataHandler::HandleDBSettingEnableChanged(const AppExecFwk::InnerEv
             TELEPHONY_LOGE("Slot%{public}d: policy is force_open, not allow clear connections", slotId_);
             return;
         }
+        pdnBringUpPending_ = false;
         ClearAllConnections(DisConnectionReason::REASON_CLEAR_CONNECTION);
     }
 }
@@ -2672,7 +3032,7 @@ void CellularDataHandler::GetDataConnApnAttr(ApnItem::Attribute &apnAttr) const
             if (apnItem == nullptr) {
                 continue;
             }
-            apnAttr = apnItem->attr_;
+            apnItem->attr_.ToAttribute(apnAttr);
             return;
         }
     }
@@ -2820,7 +3180,13 @@ void CellularDataHandler::HandleUpdateNetInfo(const AppExecFwk::InnerEvent::Poin
         TELEPHONY_LOGE("stateMachine is null");
         return;
     }
-    stateMachine->UpdateNetworkInfo(*netInfo);
+    std::shared_ptr<SetupDataCallResultInfo> latestNetInfo = stateMachine->TakePendingNetworkInfo();
+    if (latestNetInfo == nullptr) {
+        // an earlier event of the same burst already applied the latest info
+        TELEPHONY_LOGD("Slot%{public}d: data call info already applied", slotId_);
+        return;
+    }
+    stateMachine->UpdateNetworkInfo(*latestNetInfo);
 }
 
 bool CellularDataHandler::IsGsm()
@@ -2875,48 +3241,22 @@ ApnActivateReportInfo CellularDataHandler::GetInternalActReportInfo()
     return GetApnActReportInfo(DATA_CONTEXT_ROLE_INTERNAL_DEFAULT_ID);
 }
 
+std::string CellularDataHandler::GetPendingIntentDump() const
+{
+    return "coalesced: " + std::to_string(pendingIntents_.GetCoalescedCount()) +
+        " executed: " + std::to_string(pendingIntents_.GetExecutedCount());
+}
+
 ApnActivateReportInfo CellularDataHandler::GetApnActReportInfo(uint32_t apnId)
 {
-    struct ApnActivateReportInfo info;
-    uint32_t totalDuration = 0;
-    uint32_t totalActTimes = 0;
-    uint32_t totalActSuccTimes = 0;
-    uint32_t topReason = 0;
-    uint32_t topReasonCnt = 0;
-    std::map<uint32_t, uint32_t> errorMap;
-    std::unique_lock<std::mutex> lock(apnActivateListMutex_);
-    EraseApnActivateList();
-    for (uint32_t i = 0; i < apnActivateChrList_.size(); i++) {
-        ApnActivateInfo info = apnActivateChrList_[i];
-        if (info.apnId != apnId) {
-            continue;
-        }
-        totalDuration += info.duration;
-        totalActTimes++;
-        if (info.reason == 0) {
-            totalActSuccTimes++;
-            continue;
-        }
-        if (errorMap.find(info.reason) != errorMap.end()) {
-            errorMap[info.reason] = errorMap[info.reason]+1;
-        } else {
-            errorMap[info.reason] = 1;
-        }
+    ApnActivateReportInfo info = {};
+    if (apnId == DATA_CONTEXT_ROLE_DEFAULT_ID) {
+        info = defaultApnActStats_.GetReportInfo(GetCurTime());
+    } else if (apnId == DATA_CONTEXT_ROLE_INTERNAL_DEFAULT_ID) {
+        info = internalApnActStats_.GetReportInfo(GetCurTime());
     }
-    lock.unlock();
-    info.actTimes = totalActTimes;
-    info.actSuccTimes = totalActSuccTimes;
-    info.averDuration = totalActSuccTimes == 0 ? 0 : totalDuration / totalActSuccTimes;
-    std::map<uint32_t, uint32_t>::iterator iter;
-    for (iter = errorMap.begin(); iter != errorMap.end(); ++iter) {
-        if (iter->second > topReasonCnt) {
-            topReason = iter->first;
-            topReasonCnt = iter->second;
-        }
-    }
-    info.topReason = topReason;
-    TELEPHONY_LOGD("GetApnActReportInfo,%{public}d,%{public}d,%{public}d,%{public}d,%{public}d,",
-        totalDuration, totalActTimes, totalActSuccTimes, topReason, topReasonCnt);
+    TELEPHONY_LOGD("GetApnActReportInfo,%{public}d,%{public}d,%{public}d,%{public}d,",
+        info.actTimes, info.actSuccTimes, info.averDuration, info.topReason);
     return info;
 }
 
@@ -2933,33 +3273,13 @@ void CellularDataHandler::SetApnActivateStart(const std::string &apnType)
 
 void CellularDataHandler::SetApnActivateEnd(const std::shared_ptr<SetupDataCallResultInfo> &resultInfo)
 {
-    struct ApnActivateInfo info;
-    info.actSuccTime = GetCurTime();
-    info.reason = resultInfo->reason;
-    info.apnId = resultInfo->flag;
-    if (resultInfo->flag == DATA_CONTEXT_ROLE_INTERNAL_DEFAULT_ID
-        && internalApnActTime_ != 0) {
-        info.duration = info.actSuccTime - internalApnActTime_;
-    }
-    if (resultInfo->flag == DATA_CONTEXT_ROLE_DEFAULT_ID
-        && defaultApnActTime_ != 0) {
-        info.duration = info.actSuccTime - defaultApnActTime_;
-    }
-    std::lock_guard<std::mutex> lock(apnActivateListMutex_);
-    EraseApnActivateList();
-    apnActivateChrList_.push_back(info);
-}
-
-void CellularDataHandler::EraseApnActivateList()
-{
-    int64_t currentTime = GetCurTime();
-    for (std::vector<ApnActivateInfo>::iterator iter = apnActivateChrList_.begin();
-        iter != apnActivateChrList_.end();) {
-        if ((currentTime - iter->actSuccTime) > KEEP_APN_ACTIVATE_PERIOD) {
-            iter = apnActivateChrList_.erase(iter);
-        } else {
-            iter++;
-        }
+    int64_t actSuccTime = GetCurTime();
+    if (resultInfo->flag == DATA_CONTEXT_ROLE_DEFAULT_ID) {
+        uint32_t duration = defaultApnActTime_ == 0 ? 0 : static_cast<uint32_t>(actSuccTime - defaultApnActTime_);
+        defaultApnActStats_.Add(actSuccTime, duration, static_cast<uint32_t>(resultInfo->reason));
+    } else if (resultInfo->flag == DATA_CONTEXT_ROLE_INTERNAL_DEFAULT_ID) {
+        uint32_t duration = internalApnActTime_ == 0 ? 0 : static_cast<uint32_t>(actSuccTime - internalApnActTime_);
+        internalApnActStats_.Add(actSuccTime, duration, static_cast<uint32_t>(resultInfo->reason));
     }
 }
 
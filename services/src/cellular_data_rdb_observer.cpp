@@ -16,6 +16,7 @@
 #include "cellular_data_rdb_observer.h"
 
 #include "cellular_data_event_code.h"
+#include "cellular_data_rdb_helper.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -30,6 +31,10 @@ CellularDataRdbObserver::~CellularDataRdbObserver() = default;
 void CellularDataRdbObserver::OnChange()
 {
     TELEPHONY_LOGI("OnChange");
+    auto cellularDataRdbHelper = CellularDataRdbHelper::GetInstance();
+    if (cellularDataRdbHelper != nullptr) {
+        cellularDataRdbHelper->InvalidateApnCache();
+    }
     auto cellularDataHandler = cellularDataHandler_.lock();
     if (cellularDataHandler == nullptr) {
         TELEPHONY_LOGE("cellularDataHandler is null");
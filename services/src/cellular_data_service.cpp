@@ -22,6 +22,7 @@
 #include "cellular_data_hisysevent.h"
 #include "cellular_data_utils.h"
 #include "core_manager_inner.h"
+#include "data_setup_timeline.h"
 #include "telephony_ext_wrapper.h"
 #include "telephony_common_utils.h"
 #include "telephony_permission.h"
@@ -440,6 +441,7 @@ int32_t CellularDataService::RequestNet(const NetRequest &request)
         TELEPHONY_LOGE("Slot%{public}d, simId%{public}d: cellularDataController == nullptr", slotId, simId);
         return CELLULAR_DATA_INVALID_PARAM;
     }
+    DataSetupTimeline::Mark(slotId, ApnManager::FindApnIdByCapability(request.capability), SetupStage::REQUEST_NET);
     bool result = cellularDataController->RequestNet(request);
     return static_cast<int32_t>(result ? RequestNetCode::REQUEST_SUCCESS : RequestNetCode::REQUEST_FAILED);
 }
@@ -597,6 +599,29 @@ std::string CellularDataService::GetFlowDataInfoDump()
     return oss.str();
 }
 
+std::string CellularDataService::GetPendingIntentDump()
+{
+    std::ostringstream oss;
+    int32_t slotId;
+    GetDefaultCellularDataSlotId(slotId);
+    std::shared_ptr<CellularDataController> cellularDataController = GetCellularDataController(slotId);
+    if (cellularDataController == nullptr) {
+        oss << "default slotId: " << slotId;
+        return oss.str();
+    }
+    oss << cellularDataController->GetPendingIntentDump();
+    return oss.str();
+}
+
+std::string CellularDataService::GetApnCacheDump()
+{
+    auto helper = CellularDataRdbHelper::GetInstance();
+    if (helper == nullptr) {
+        return "";
+    }
+    return helper->GetApnCacheDump();
+}
+
 int32_t CellularDataService::StrategySwitch(int32_t slotId, bool enable)
 {
     std::shared_ptr<CellularDataController> cellularDataController = GetCellularDataController(slotId);
@@ -25,6 +25,7 @@ namespace Telephony {
 
 DataConnectionManager::DataConnectionManager(int32_t slotId) : StateMachine("DataConnectionManager"), slotId_(slotId)
 {
+    SetSlotId(slotId);
     connectionMonitor_ = std::make_shared<DataConnectionMonitor>(slotId);
     if (connectionMonitor_ == nullptr) {
         TELEPHONY_LOGE("Slot%{public}d: connectionMonitor_ is null", slotId_);
@@ -359,7 +360,7 @@ void DataConnectionManager::GetDefaultBandWidthsConfig()
     if (linkBandwidthVec.empty()) {
         linkBandwidthVec = CellularDataUtils::Split(DEFAULT_BANDWIDTH_CONFIG, ";");
     }
-    std::lock_guard<std::mutex> lock(bandwidthConfigMutex_);
+    std::unique_lock<std::mutex> lock(bandwidthConfigMutex_);
     bandwidthConfigMap_.clear();
     for (std::string temp : linkBandwidthVec) {
         std::vector<std::string> linkBandwidths = CellularDataUtils::Split(temp, ":");
@@ -377,6 +378,8 @@ void DataConnectionManager::GetDefaultBandWidthsConfig()
     }
     TELEPHONY_LOGI("Slot%{public}d: BANDWIDTH_CONFIG_MAP size is %{public}zu", slotId_, bandwidthConfigMap_.size());
     UpdateBandWidthsUseLte();
+    lock.unlock();
+    PublishLinkConfigTable();
 }
 
 void DataConnectionManager::UpdateBandWidthsUseLte()
@@ -405,7 +408,7 @@ void DataConnectionManager::GetDefaultTcpBufferConfig()
     char tcpBufferConfig[MAX_BUFFER_SIZE] = {0};
     GetParameter(CONFIG_TCP_BUFFER, DEFAULT_TCP_BUFFER_CONFIG, tcpBufferConfig, MAX_BUFFER_SIZE);
     std::vector<std::string> tcpBufferVec = CellularDataUtils::Split(tcpBufferConfig, ";");
-    std::lock_guard<std::mutex> lock(tcpBufferConfigMutex_);
+    std::unique_lock<std::mutex> lock(tcpBufferConfigMutex_);
     tcpBufferConfigMap_.clear();
     for (std::string tcpBuffer : tcpBufferVec) {
         std::vector<std::string> str = CellularDataUtils::Split(tcpBuffer, ":");
@@ -416,33 +419,32 @@ void DataConnectionManager::GetDefaultTcpBufferConfig()
         tcpBufferConfigMap_.emplace(str.front(), str.back());
     }
     TELEPHONY_LOGI("Slot%{public}d: TCP_BUFFER_CONFIG_MAP size is %{public}zu", slotId_, tcpBufferConfigMap_.size());
+    lock.unlock();
+    PublishLinkConfigTable();
+}
+
+void DataConnectionManager::PublishLinkConfigTable()
+{
+    std::lock_guard<std::mutex> bandwidthLock(bandwidthConfigMutex_);
+    std::lock_guard<std::mutex> tcpBufferLock(tcpBufferConfigMutex_);
+    std::atomic_store(&linkConfigTable_, LinkConfigTable::Build(bandwidthConfigMap_, tcpBufferConfigMap_));
 }
 
 LinkBandwidthInfo DataConnectionManager::GetBandwidthsByRadioTech(const int32_t radioTech)
 {
     LinkBandwidthInfo linkBandwidthInfo;
-    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
-    NrState nrState = coreInner.GetNrState(slotId_);
-    FrequencyType frequencyType = coreInner.GetFrequencyType(slotId_);
-    std::string radioTechName = CellularDataUtils::ConvertRadioTechToRadioName(radioTech);
-    if (radioTech == (int32_t)RadioTech::RADIO_TECHNOLOGY_LTE &&
-        (nrState == NrState::NR_NSA_STATE_DUAL_CONNECTED || nrState == NrState::NR_NSA_STATE_CONNECTED_DETECT)) {
-        if (frequencyType == FrequencyType::FREQ_TYPE_MMWAVE) {
-            radioTechName = "NR_NSA_MMWAVE";
-        } else {
-            radioTechName = "NR_NSA";
-        }
-    }
-    if (radioTechName == "NR") {
-        radioTechName = "NR_SA";
-    }
-    TELEPHONY_LOGD("Slot%{public}d: accessRadioName is %{private}s", slotId_, radioTechName.c_str());
-    std::lock_guard<std::mutex> lock(bandwidthConfigMutex_);
-    std::map<std::string, LinkBandwidthInfo>::iterator iter = bandwidthConfigMap_.find(radioTechName);
-    if (iter != bandwidthConfigMap_.end()) {
-        linkBandwidthInfo = iter->second;
-        TELEPHONY_LOGI("Slot%{public}d: name is %{private}s upBandwidth = %{public}u downBandwidth = %{public}u",
-            slotId_, iter->first.c_str(), linkBandwidthInfo.upBandwidth, linkBandwidthInfo.downBandwidth);
+    std::shared_ptr<const LinkConfigTable> linkConfigTable = std::atomic_load(&linkConfigTable_);
+    if (linkConfigTable == nullptr) {
+        return linkBandwidthInfo;
+    }
+    NrState nrState {};
+    FrequencyType frequencyType {};
+    GetNrContext(nrState, frequencyType);
+    LinkConfigNrMode nrMode = LinkConfigTable::GetNrMode(nrState, frequencyType);
+    if (linkConfigTable->GetBandwidth(radioTech, nrMode, linkBandwidthInfo)) {
+        TELEPHONY_LOGI("Slot%{public}d: radioTech %{public}d nrMode %{public}zu upBandwidth = %{public}u "
+            "downBandwidth = %{public}u", slotId_, radioTech, static_cast<size_t>(nrMode),
+            linkBandwidthInfo.upBandwidth, linkBandwidthInfo.downBandwidth);
     }
     return linkBandwidthInfo;
 }
@@ -450,22 +452,38 @@ LinkBandwidthInfo DataConnectionManager::GetBandwidthsByRadioTech(const int32_t
 std::string DataConnectionManager::GetTcpBufferByRadioTech(const int32_t radioTech)
 {
     std::string tcpBuffer = "";
-    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
-    NrState nrState = coreInner.GetNrState(slotId_);
-    std::string radioTechName = CellularDataUtils::ConvertRadioTechToRadioName(radioTech);
-    if ((radioTech == (int32_t)RadioTech::RADIO_TECHNOLOGY_LTE ||
-        radioTech == (int32_t)RadioTech::RADIO_TECHNOLOGY_LTE_CA) &&
-        (nrState == NrState::NR_NSA_STATE_DUAL_CONNECTED || nrState == NrState::NR_NSA_STATE_CONNECTED_DETECT)) {
-        radioTechName = "NR";
-    }
-    std::lock_guard<std::mutex> lock(tcpBufferConfigMutex_);
-    std::map<std::string, std::string>::iterator iter = tcpBufferConfigMap_.find(radioTechName);
-    if (iter != tcpBufferConfigMap_.end()) {
-        tcpBuffer = iter->second;
-    }
+    std::shared_ptr<const LinkConfigTable> linkConfigTable = std::atomic_load(&linkConfigTable_);
+    if (linkConfigTable == nullptr) {
+        return tcpBuffer;
+    }
+    NrState nrState {};
+    FrequencyType frequencyType {};
+    GetNrContext(nrState, frequencyType);
+    linkConfigTable->GetTcpBuffer(radioTech, LinkConfigTable::GetNrMode(nrState, frequencyType), tcpBuffer);
     return tcpBuffer;
 }
 
+void DataConnectionManager::SetRadioContext(const std::shared_ptr<const RadioContextSnapshot> &radioContext)
+{
+    std::lock_guard<std::mutex> lock(radioContextMutex_);
+    radioContext_ = radioContext;
+}
+
+void DataConnectionManager::GetNrContext(NrState &nrState, FrequencyType &frequencyType)
+{
+    std::unique_lock<std::mutex> lock(radioContextMutex_);
+    std::shared_ptr<const RadioContextSnapshot> radioContext = radioContext_;
+    lock.unlock();
+    if (radioContext != nullptr) {
+        nrState = radioContext->nrState;
+        frequencyType = radioContext->frequencyType;
+        return;
+    }
+    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
+    nrState = coreInner.GetNrState(slotId_);
+    frequencyType = coreInner.GetFrequencyType(slotId_);
+}
+
 void DataConnectionManager::IsNeedDoRecovery(bool needDoRecovery) const
 {
     if (connectionMonitor_ != nullptr) {
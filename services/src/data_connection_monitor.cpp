@@ -13,11 +13,15 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "core_manager_inner.h"
 
 #include "cellular_data_hisysevent.h"
+#include "cellular_data_perf_stats.h"
 #include "cellular_data_service.h"
 #include "data_service_ext_wrapper.h"
+#include "parameter.h"
 #include "telephony_ext_wrapper.h"
 
 namespace OHOS {
@@ -29,6 +33,18 @@ DataConnectionMonitor::DataConnectionMonitor(int32_t slotId) : TelEventHandler("
     if (trafficManager_ == nullptr || stallDetectionTrafficManager_ == nullptr) {
         TELEPHONY_LOGE("TrafficManager or stallDetectionTrafficManager init failed");
     }
+    LoadStallDetectorConfig();
+}
+
+void DataConnectionMonitor::LoadStallDetectorConfig()
+{
+    StallDetectorConfig config;
+    config.windowSize = GetIntParameter(CONFIG_STALL_WINDOW_SIZE, config.windowSize);
+    config.minTxPackets = GetIntParameter(CONFIG_STALL_MIN_TX_PACKETS, RECOVERY_TRIGGER_PACKET);
+    config.confidencePercent = GetIntParameter(CONFIG_STALL_CONFIDENCE, config.confidencePercent);
+    stallDetector_.SetConfig(config);
+    TELEPHONY_LOGD("Slot%{public}d: stall window %{public}d, confidence %{public}d", slotId_, config.windowSize,
+        config.confidencePercent);
 }
 
 void DataConnectionMonitor::HandleScreenStateChanged(bool isScreenOn)
@@ -68,16 +84,32 @@ bool DataConnectionMonitor::IsAggressiveRecovery()
  
 int32_t DataConnectionMonitor::GetStallDetectionPeriod()
 {
+    int32_t period = DATA_STALL_ALARM_NON_AGGRESSIVE_DELAY_IN_MS_DEFAULT;
     if (isScreenOn_ || IsAggressiveRecovery()) {
-        return DATA_STALL_ALARM_AGGRESSIVE_DELAY_IN_MS_DEFAULT;
+        period = DATA_STALL_ALARM_AGGRESSIVE_DELAY_IN_MS_DEFAULT;
     }
-    return DATA_STALL_ALARM_NON_AGGRESSIVE_DELAY_IN_MS_DEFAULT;
+    if (stallRounds_ > 0) {
+        // packets keep going out without any answer, confirm the stall sooner
+        int32_t shift = std::min(stallRounds_, DATA_STALL_ALARM_MAX_BACKOFF_SHIFT);
+        return std::max(period >> shift, DATA_STALL_ALARM_MIN_DELAY_IN_MS);
+    }
+    if (idleRounds_ > 0 && !IsAggressiveRecovery()) {
+        // nothing is sent, there is nothing to detect until the link is used again
+        int32_t shift = std::min(idleRounds_, DATA_STALL_ALARM_MAX_BACKOFF_SHIFT);
+        int64_t maxPeriod =
+            isScreenOn_ ? DATA_STALL_ALARM_SCREEN_ON_MAX_DELAY_IN_MS : DATA_STALL_ALARM_SCREEN_OFF_MAX_DELAY_IN_MS;
+        return static_cast<int32_t>(std::min(static_cast<int64_t>(period) << shift, maxPeriod));
+    }
+    return period;
 }
 
 void DataConnectionMonitor::StartStallDetectionTimer()
 {
     TELEPHONY_LOGD("Slot%{public}d: start stall detection", slotId_);
     stallDetectionEnabled_ = true;
+    idleRounds_ = 0;
+    stallRounds_ = 0;
+    stallDetector_.Reset();
     int32_t stallDetectionPeriod = GetStallDetectionPeriod();
     TELEPHONY_LOGD("stallDetectionPeriod = %{public}d", stallDetectionPeriod);
     if (!HasInnerEvent(CellularDataEventCode::MSG_STALL_DETECTION_EVENT_ID)) {
@@ -99,11 +131,12 @@ __attribute__((no_sanitize("cfi"))) void DataConnectionMonitor::OnStallDetection
     UpdateFlowInfo();
     int32_t dataState = static_cast<int32_t>(DataConnectState::DATA_STATE_UNKNOWN);
     DelayedRefSingleton<CellularDataService>::GetInstance().GetCellularDataState(dataState);
-    if (noRecvPackets_ > RECOVERY_TRIGGER_PACKET ||
+    if (stallDetector_.IsStalled() ||
         (dataState != static_cast<int32_t>(DataConnectionStatus::DATA_STATE_CONNECTED) &&
         dataRecoveryState_ == RecoveryState::STATE_RADIO_STATUS_RESTART)) {
+        TELEPHONY_LOGI("Slot%{public}d: data stall confidence %{public}d", slotId_, stallDetector_.GetConfidence());
         HandleRecovery();
-        noRecvPackets_ = 0;
+        stallDetector_.Reset();
     }
     int32_t stallDetectionPeriod = GetStallDetectionPeriod();
     TELEPHONY_LOGD("stallDetectionPeriod = %{public}d", stallDetectionPeriod);
@@ -136,13 +169,23 @@ void DataConnectionMonitor::UpdateFlowInfo()
     stallDetectionTrafficManager_->GetPacketData(currentSentPackets, currentRecvPackets);
     int64_t sentPackets = currentSentPackets - previousSentPackets;
     int64_t recvPackets = currentRecvPackets - previousRecvPackets;
+    TrafficDelta delta;
+    delta.txPackets = sentPackets;
+    delta.rxPackets = recvPackets;
+    stallDetector_.AddSample(delta);
     if (sentPackets > 0 && recvPackets == 0) {
-        noRecvPackets_ += sentPackets;
+        stallRounds_++;
+        idleRounds_ = 0;
     } else if ((sentPackets > 0 && recvPackets > 0) || (sentPackets == 0 && recvPackets > 0)) {
-        noRecvPackets_ = 0;
         dataRecoveryState_ = RecoveryState::STATE_REQUEST_CONTEXT_LIST;
+        stallRounds_ = 0;
+        idleRounds_ = 0;
     } else {
         TELEPHONY_LOGD("Slot%{public}d: Update Flow Info nothing to do", slotId_);
+        if (sentPackets == 0 && recvPackets == 0) {
+            idleRounds_++;
+            stallRounds_ = 0;
+        }
     }
 }
 
@@ -338,6 +381,7 @@ void DataConnectionMonitor::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &
         TELEPHONY_LOGE("Slot%{public}d: event is null", slotId_);
         return;
     }
+    CellularDataPerfScope perfScope(PerfComponent::MONITOR, slotId_, event);
     uint32_t eventID = event->GetInnerEventId();
     switch (eventID) {
         case CellularDataEventCode::MSG_RUN_MONITOR_TASK: {
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pending_intent_table.h"
+
+#include <chrono>
+
+#include "cellular_data_constant.h"
+
+namespace OHOS {
+namespace Telephony {
+// a queued event not handled within this time is treated as lost and no longer coalesces new ones
+static constexpr int64_t PENDING_INTENT_TIMEOUT_MS = 10 * 1000;
+
+bool PendingIntentTable::AddNetRequest(int32_t apnId, const std::string &ident, int32_t type, uint64_t bearTypes)
+{
+    int64_t nowMs = GetSteadyTimeMs();
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::deque<NetRequestIntent> &queue = netRequests_[apnId];
+    while (!queue.empty() && nowMs - queue.front().sendTime > PENDING_INTENT_TIMEOUT_MS) {
+        queue.pop_front();
+    }
+    if (type == TYPE_RELEASE_NET) {
+        // a release drops all requests of the apn, releasing twice in a row changes nothing
+        if (!queue.empty() && queue.back().type == TYPE_RELEASE_NET && queue.back().bearTypes == bearTypes) {
+            coalescedCount_++;
+            return false;
+        }
+    } else {
+        for (auto it = queue.rbegin(); it != queue.rend() && it->type != TYPE_RELEASE_NET; ++it) {
+            if (it->ident == ident && it->bearTypes == bearTypes) {
+                coalescedCount_++;
+                return false;
+            }
+        }
+    }
+    queue.push_back({ ident, type, bearTypes, nowMs });
+    return true;
+}
+
+void PendingIntentTable::FinishNetRequest(int32_t apnId, const std::string &ident, int32_t type)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = netRequests_.find(apnId);
+    if (iter == netRequests_.end()) {
+        return;
+    }
+    std::deque<NetRequestIntent> &queue = iter->second;
+    for (auto it = queue.begin(); it != queue.end(); ++it) {
+        if (it->type == type && (type == TYPE_RELEASE_NET || it->ident == ident)) {
+            queue.erase(it);
+            break;
+        }
+    }
+    if (queue.empty()) {
+        netRequests_.erase(iter);
+    }
+}
+
+bool PendingIntentTable::AddEstablish(int32_t apnId, int64_t delayTime, bool force)
+{
+    int64_t nowMs = GetSteadyTimeMs();
+    int64_t dueTime = nowMs + delayTime;
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::multiset<int64_t> &dueTimes = establishDueTimes_[apnId];
+    while (!dueTimes.empty() && nowMs - *dueTimes.begin() > PENDING_INTENT_TIMEOUT_MS) {
+        dueTimes.erase(dueTimes.begin());
+    }
+    if (!force && !dueTimes.empty() && *dueTimes.begin() <= dueTime) {
+        coalescedCount_++;
+        return false;
+    }
+    dueTimes.insert(dueTime);
+    return true;
+}
+
+void PendingIntentTable::FinishEstablish(int32_t apnId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = establishDueTimes_.find(apnId);
+    if (iter == establishDueTimes_.end()) {
+        return;
+    }
+    if (!iter->second.empty()) {
+        iter->second.erase(iter->second.begin());
+    }
+    if (iter->second.empty()) {
+        establishDueTimes_.erase(iter);
+    }
+}
+
+void PendingIntentTable::AddCoalescedCount()
+{
+    coalescedCount_++;
+}
+
+void PendingIntentTable::AddExecutedCount()
+{
+    executedCount_++;
+}
+
+uint64_t PendingIntentTable::GetCoalescedCount() const
+{
+    return coalescedCount_.load();
+}
+
+uint64_t PendingIntentTable::GetExecutedCount() const
+{
+    return executedCount_.load();
+}
+
+void PendingIntentTable::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    netRequests_.clear();
+    establishDueTimes_.clear();
+}
+
+int64_t PendingIntentTable::GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -16,6 +16,7 @@
 #include "activating.h"
 
 #include "cellular_data_hisysevent.h"
+#include "data_setup_timeline.h"
 #include "inactive.h"
 #include "radio_event.h"
 #include "apn_manager.h"
@@ -66,6 +67,7 @@ bool Activating::RilActivatePdpContextDone(const AppExecFwk::InnerEvent::Pointer
             stateMachine->connectId_.load(), resultInfo->flag);
         return false;
     }
+    DataSetupTimeline::Mark(stateMachine->GetSlotId(), stateMachine->apnId_, SetupStage::PDP_CONTEXT_DONE);
     auto inActive = std::static_pointer_cast<Inactive>(stateMachine->inActiveState_);
     if (inActive == nullptr) {
         TELEPHONY_LOGE("Inactive is null");
@@ -17,6 +17,8 @@
 
 #include "cellular_data_hisysevent.h"
 #include "core_manager_inner.h"
+#include "data_setup_timeline.h"
+#include "event_dispatch_table.h"
 #include "inactive.h"
 #include "telephony_ext_wrapper.h"
 #include "apn_manager.h"
@@ -32,6 +34,7 @@ void Active::StateBegin()
         return;
     }
     isActive_ = true;
+    DataSetupTimeline::Mark(stateMachine->GetSlotId(), stateMachine->apnId_, SetupStage::ACTIVE_ENTERED);
     RefreshTcpBufferSizes();
     RefreshConnectionBandwidths();
     stateMachine->SetCurrentState(shared_from_this());
@@ -50,11 +53,24 @@ bool Active::StateProcess(const AppExecFwk::InnerEvent::Pointer &event)
     }
     bool retVal = false;
     uint32_t eventCode = event->GetInnerEventId();
-    std::map<uint32_t, Fun>::iterator it = eventIdFunMap_.find(eventCode);
-    if (it != eventIdFunMap_.end()) {
-        if (it->second != nullptr) {
-            return it->second(event);
-        }
+    static constexpr auto dispatchTable = MakeEventDispatchTable<Active, bool>({
+        { CellularDataEventCode::MSG_SM_CONNECT, &Active::ProcessConnectDone },
+        { CellularDataEventCode::MSG_SM_DISCONNECT, &Active::ProcessDisconnectDone },
+        { CellularDataEventCode::MSG_SM_DISCONNECT_ALL, &Active::ProcessDisconnectAllDone },
+        { CellularDataEventCode::MSG_SM_LOST_CONNECTION, &Active::ProcessLostConnection },
+        { CellularDataEventCode::MSG_SM_LINK_CAPABILITY_CHANGED, &Active::ProcessLinkCapabilityChanged },
+        { CellularDataEventCode::MSG_SM_DATA_ROAM_ON, &Active::ProcessDataConnectionRoamOn },
+        { CellularDataEventCode::MSG_SM_DATA_ROAM_OFF, &Active::ProcessDataConnectionRoamOff },
+        { CellularDataEventCode::MSG_SM_VOICE_CALL_STARTED, &Active::ProcessDataConnectionVoiceCallStartedOrEnded },
+        { CellularDataEventCode::MSG_SM_VOICE_CALL_ENDED, &Active::ProcessDataConnectionVoiceCallStartedOrEnded },
+        { CellularDataEventCode::MSG_SM_RIL_ADAPTER_HOST_DIED, &Active::ProcessRilAdapterHostDied },
+        { RadioEvent::RADIO_NR_STATE_CHANGED, &Active::ProcessNrStateChanged },
+        { RadioEvent::RADIO_NR_FREQUENCY_CHANGED, &Active::ProcessNrFrequencyChanged },
+        { RadioEvent::RADIO_RIL_SETUP_DATA_CALL, &Active::ProcessDataConnectionComplete },
+    });
+    auto handler = dispatchTable.Find(eventCode);
+    if (handler != nullptr) {
+        return (this->*handler)(event);
     }
     return retVal;
 }
@@ -22,6 +22,7 @@
 #include "cellular_data_hisysevent.h"
 #include "cellular_data_utils.h"
 #include "core_manager_inner.h"
+#include "data_setup_timeline.h"
 #include "default.h"
 #include "disconnecting.h"
 #include "inactive.h"
@@ -45,6 +46,7 @@ void CellularDataStateMachine::UnregisterNetInterfaceCallback()
     if (netInterfaceCallback_ != nullptr) {
         OHOS::NetManagerStandard::NetConnClient::GetInstance().UnregisterNetInterfaceCallback(
             netInterfaceCallback_);
+        netInterfaceCallback_ = nullptr;
     }
 }
 
@@ -132,6 +134,7 @@ void CellularDataStateMachine::DoConnect(const DataConnectionParams &connectionP
         return;
     }
     const int32_t slotId = GetSlotId();
+    DataSetupTimeline::Mark(slotId, apnId_, SetupStage::DO_CONNECT, connectId_.load());
     int32_t radioTech = static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_INVALID);
     CoreManagerInner::GetInstance().GetPsRadioTech(slotId, radioTech);
     ActivateDataParam activeDataParam;
@@ -151,7 +154,8 @@ void CellularDataStateMachine::DoConnect(const DataConnectionParams &connectionP
     activeDataParam.dataProfile.supportedApnTypesBitmap = bitMap;
     HILOG_COMM_IMPL(LOG_INFO, LOG_DOMAIN, TELEPHONY_LOG_TAG,
         "Slot%{public}d: Activate PDP context (%{public}d, %{public}s, %{public}s, %{public}s, %{public}d)",
-        slotId, apn->attr_.profileId_, apn->attr_.apn_, apn->attr_.protocol_, apn->attr_.types_, bitMap);
+        slotId, apn->attr_.profileId_, apn->attr_.apn_.c_str(), apn->attr_.protocol_.c_str(),
+        apn->attr_.types_.c_str(), bitMap);
     int32_t result = CoreManagerInner::GetInstance().ActivatePdpContext(slotId, RadioEvent::RADIO_RIL_SETUP_DATA_CALL,
         activeDataParam, stateMachineEventHandler_);
     if (result != TELEPHONY_ERR_SUCCESS) {
@@ -236,6 +240,7 @@ bool CellularDataStateMachine::operator==(const CellularDataStateMachine &stateM
 
 void CellularDataStateMachine::Init()
 {
+    SetSlotId(GetSlotId());
     activeState_ = std::make_shared<Active>(
         std::weak_ptr<CellularDataStateMachine>(shared_from_this()), "Active");
     inActiveState_ = std::make_shared<Inactive>(
@@ -422,10 +427,14 @@ void CellularDataStateMachine::UpdateNetworkInfo(const SetupDataCallResultInfo &
     netSupplierInfo_->score_ = GetNetScoreBySlotId(slotId);
     cause_ = dataCallInfo.reason;
     CellularDataNetAgent &netAgent = CellularDataNetAgent::GetInstance();
+    if (capability_ == NetManagerStandard::NetCap::NET_CAPABILITY_INTERNET) {
+        netAgent.SetCellIfaceName(slotId, netSupplierInfo_->isAvailable_ ? dataCallInfo.netPortName : "");
+    }
     int32_t supplierId = netAgent.GetSupplierId(slotId, capability_);
     netAgent.UpdateNetSupplierInfo(supplierId, netSupplierInfo_);
     if (netSupplierInfo_->isAvailable_) {
         netAgent.UpdateNetLinkInfo(supplierId, netLinkInfo_);
+        DataSetupTimeline::Mark(slotId, apnId_, SetupStage::NETWORK_INFO_UPDATED);
     }
 }
 
@@ -539,9 +548,34 @@ void CellularDataStateMachine::UpdateNetworkInfoIfInActive(SetupDataCallResultIn
     }
     auto netInfo = std::make_shared<SetupDataCallResultInfo>(info);
     netInfo->flag = apnId_;
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(pendingNetInfoMutex_);
+    pendingNetInfo_ = netInfo;
+    if (now < coalesceWindowEnd_) {
+        // updates inside the window share one trailing event that applies the latest info
+        if (!trailingScheduled_) {
+            trailingScheduled_ = true;
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(coalesceWindowEnd_ - now);
+            cellularDataHandler_->SendEvent(
+                CellularDataEventCode::MSG_DATA_CALL_LIST_CHANGED, netInfo, remaining.count());
+        }
+        TELEPHONY_LOGD("cid:%{public}d coalesce data call list update", cid_);
+        return;
+    }
+    coalesceWindowEnd_ = now + std::chrono::milliseconds(DATA_CALL_LIST_COALESCE_WINDOW_MS);
+    trailingScheduled_ = false;
     cellularDataHandler_->SendEvent(CellularDataEventCode::MSG_DATA_CALL_LIST_CHANGED, netInfo);
 }
 
+std::shared_ptr<SetupDataCallResultInfo> CellularDataStateMachine::TakePendingNetworkInfo()
+{
+    std::lock_guard<std::mutex> lock(pendingNetInfoMutex_);
+    std::shared_ptr<SetupDataCallResultInfo> netInfo = pendingNetInfo_;
+    pendingNetInfo_ = nullptr;
+    trailingScheduled_ = false;
+    return netInfo;
+}
+
 void CellularDataStateMachine::SetReuseApnCap(uint64_t cap)
 {
     reuseApnCap_ = cap;
@@ -566,7 +600,7 @@ void CellularDataStateMachine::GetNetworkSlicePara(const DataConnectionParams& c
     if (!isNrSa) {
         return;
     }
-    std::string dnn = apn->attr_.apn_;
+    std::string dnn = apn->attr_.apn_.c_str();
     TELEPHONY_LOGI("GetNetworkSlicePara apnType = %{public}s, dnn = %{public}s",
         apnType.c_str(), dnn.c_str());
     if (apnType.find("snssai") != std::string::npos) {
@@ -583,10 +617,7 @@ void CellularDataStateMachine::GetNetworkSlicePara(const DataConnectionParams& c
             dnn, snssai, sscMode);
         apn->attr_.sscMode_ = sscMode;
         if (!snssai.empty()) {
-            std::fill(apn->attr_.snssai_, apn->attr_.snssai_ + ApnItem::ALL_APN_ITEM_CHAR_LENGTH, '\0');
-            size_t len = std::min(snssai.size(), static_cast<size_t>(ApnItem::ALL_APN_ITEM_CHAR_LENGTH - 1));
-            std::copy(snssai.begin(), snssai.begin() + len, apn->attr_.snssai_);
-            apn->attr_.snssai_[len] = '\0';
+            apn->attr_.snssai_ = snssai.substr(0, ApnItem::ALL_APN_ITEM_CHAR_LENGTH - 1);
         }
         TELEPHONY_LOGI("GetRouteSelectionDescriptorByDNN snssai = %{public}s, sscmode = %{public}d",
             snssai.c_str(), sscMode);
@@ -603,29 +634,16 @@ void CellularDataStateMachine::FillRSDFromNetCap(
         apn->attr_.sscMode_ = sscMode;
     }
 
-    constexpr size_t BUF_SIZE = ApnItem::ALL_APN_ITEM_CHAR_LENGTH;
-    constexpr size_t MAX_COPY = BUF_SIZE - 1;
+    constexpr size_t MAX_COPY = ApnItem::ALL_APN_ITEM_CHAR_LENGTH - 1;
 
     if (networkSliceParas["snssai"] != "") {
-        std::string snssai = networkSliceParas["snssai"];
-        std::fill(apn->attr_.snssai_, apn->attr_.snssai_ + BUF_SIZE, '\0');
-        size_t len = std::min(snssai.size(), MAX_COPY);
-        std::copy(snssai.begin(), snssai.begin() + len, apn->attr_.snssai_);
-        apn->attr_.snssai_[len] = '\0';
+        apn->attr_.snssai_ = networkSliceParas["snssai"].substr(0, MAX_COPY);
     }
     if (networkSliceParas["dnn"] != "") {
-        std::string dnn = networkSliceParas["dnn"];
-        std::fill(apn->attr_.apn_, apn->attr_.apn_ + BUF_SIZE, '\0');
-        size_t len = std::min(dnn.size(), MAX_COPY);
-        std::copy(dnn.begin(), dnn.begin() + len, apn->attr_.apn_);
-        apn->attr_.apn_[len] = '\0';
+        apn->attr_.apn_ = networkSliceParas["dnn"].substr(0, MAX_COPY);
     }
     if (networkSliceParas["pdusessiontype"] != "0") {
-        std::string pdusessiontype = networkSliceParas["pdusessiontype"];
-        std::fill(apn->attr_.protocol_, apn->attr_.protocol_ + BUF_SIZE, '\0');
-        size_t len = std::min(pdusessiontype.size(), MAX_COPY);
-        std::copy(pdusessiontype.begin(), pdusessiontype.begin() + len, apn->attr_.protocol_);
-        apn->attr_.protocol_[len] = '\0';
+        apn->attr_.protocol_ = networkSliceParas["pdusessiontype"].substr(0, MAX_COPY);
     }
     TELEPHONY_LOGI("FillRSD: snssai = %{public}s, sscmode = %{public}s, dnn = %{public}s, pdusession = %{public}s",
         networkSliceParas["snssai"].c_str(), networkSliceParas["sscmode"].c_str(), networkSliceParas["dnn"].c_str(),
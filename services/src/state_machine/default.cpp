@@ -15,6 +15,7 @@
 
 #include "default.h"
 #include "core_manager_inner.h"
+#include "event_dispatch_table.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -42,9 +43,18 @@ bool Default::StateProcess(const AppExecFwk::InnerEvent::Pointer &event)
         return false;
     }
     uint32_t eventCode = event->GetInnerEventId();
-    std::map<uint32_t, Fun>::iterator it = eventIdFunMap_.find(eventCode);
-    if (it != eventIdFunMap_.end()) {
-        return it->second(event);
+    static constexpr auto dispatchTable = MakeEventDispatchTable<Default, bool>({
+        { CellularDataEventCode::MSG_SM_CONNECT, &Default::ProcessConnectDone },
+        { CellularDataEventCode::MSG_SM_DISCONNECT, &Default::ProcessDisconnectDone },
+        { CellularDataEventCode::MSG_SM_DISCONNECT_ALL, &Default::ProcessDisconnectAllDone },
+        { CellularDataEventCode::MSG_SM_DRS_OR_RAT_CHANGED, &Default::ProcessDataConnectionDrsOrRatChanged },
+        { CellularDataEventCode::MSG_SM_DATA_ROAM_ON, &Default::ProcessDataConnectionRoamOn },
+        { CellularDataEventCode::MSG_SM_DATA_ROAM_OFF, &Default::ProcessDataConnectionRoamOff },
+        { CellularDataEventCode::MSG_SM_UPDATE_NETWORK_INFO, &Default::ProcessUpdateNetworkInfo },
+    });
+    auto handler = dispatchTable.Find(eventCode);
+    if (handler != nullptr) {
+        return (this->*handler)(event);
     }
     return false;
 }
@@ -15,6 +15,8 @@
 
 #include "inactive.h"
 
+#include "data_setup_timeline.h"
+
 namespace OHOS {
 namespace Telephony {
 void Inactive::StateBegin()
@@ -25,6 +27,7 @@ void Inactive::StateBegin()
         TELEPHONY_LOGE("stateMachine is null");
         return;
     }
+    DataSetupTimeline::Abort(stateMachine->GetSlotId(), stateMachine->apnId_);
     stateMachine->connectId_.fetch_add(1);
     isActive_ = true;
     if (deActiveApnTypeId_ != ERROR_APN_ID) {
@@ -32,6 +35,9 @@ void Inactive::StateBegin()
         if (stateMachine->netSupplierInfo_ != nullptr) {
             stateMachine->netSupplierInfo_->isAvailable_ = false;
         }
+        if (stateMachine->capability_ == NetManagerStandard::NetCap::NET_CAPABILITY_INTERNET) {
+            CellularDataNetAgent::GetInstance().SetCellIfaceName(stateMachine->GetSlotId(), "");
+        }
         // send MSG_DISCONNECT_DATA_COMPLETE to CellularDataHandler
         auto netInfo = std::make_shared<SetupDataCallResultInfo>();
         if (netInfo == nullptr) {
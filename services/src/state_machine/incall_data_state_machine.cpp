@@ -19,6 +19,7 @@
 #include "cellular_data_settings_rdb_helper.h"
 #include "cellular_data_utils.h"
 #include "core_manager_inner.h"
+#include "event_dispatch_table.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -151,6 +152,7 @@ void IncallDataStateMachine::Init(int32_t callState, int32_t slotId,
     std::weak_ptr<TelEventHandler> &&cellularDataHandler, sptr<ApnManager> &apnManager)
 {
     slotId_ = slotId;
+    SetSlotId(slotId);
     cellularDataHandler_ = std::move(cellularDataHandler);
     apnManager_ = apnManager;
     idleState_ = std::make_shared<IdleState>(std::weak_ptr<IncallDataStateMachine>(shared_from_this()), "IdleState");
@@ -241,9 +243,15 @@ bool IdleState::StateProcess(const AppExecFwk::InnerEvent::Pointer &event)
         return NOT_PROCESSED;
     }
     uint32_t eventCode = event->GetInnerEventId();
-    std::map<uint32_t, Fun>::iterator it = eventIdFunMap_.find(eventCode);
-    if (it != eventIdFunMap_.end()) {
-        return it->second(event);
+    static constexpr auto dispatchTable = MakeEventDispatchTable<IdleState, bool>({
+        { CellularDataEventCode::MSG_SM_INCALL_DATA_CALL_STARTED, &IdleState::ProcessCallStarted },
+        { CellularDataEventCode::MSG_SM_INCALL_DATA_CALL_ENDED, &IdleState::ProcessCallEnded },
+        { CellularDataEventCode::MSG_SM_INCALL_DATA_SETTINGS_ON, &IdleState::ProcessSettingsOn },
+        { CellularDataEventCode::MSG_SM_INCALL_DATA_DSDS_CHANGED, &IdleState::ProcessDsdsChanged },
+    });
+    auto handler = dispatchTable.Find(eventCode);
+    if (handler != nullptr) {
+        return (this->*handler)(event);
     }
     return NOT_PROCESSED;
 }
@@ -358,9 +366,15 @@ bool SecondaryActiveState::StateProcess(const AppExecFwk::InnerEvent::Pointer &e
         return NOT_PROCESSED;
     }
     uint32_t eventCode = event->GetInnerEventId();
-    std::map<uint32_t, Fun>::iterator it = eventIdFunMap_.find(eventCode);
-    if (it != eventIdFunMap_.end()) {
-        return it->second(event);
+    static constexpr auto dispatchTable = MakeEventDispatchTable<SecondaryActiveState, bool>({
+        { CellularDataEventCode::MSG_SM_INCALL_DATA_SETTINGS_ON, &SecondaryActiveState::ProcessSettingsOn },
+        { CellularDataEventCode::MSG_SM_INCALL_DATA_CALL_ENDED, &SecondaryActiveState::ProcessCallEnded },
+        { CellularDataEventCode::MSG_SM_INCALL_DATA_SETTINGS_OFF, &SecondaryActiveState::ProcessSettingsOff },
+        { CellularDataEventCode::MSG_SM_INCALL_DATA_DSDS_CHANGED, &SecondaryActiveState::ProcessDsdsChanged },
+    });
+    auto handler = dispatchTable.Find(eventCode);
+    if (handler != nullptr) {
+        return (this->*handler)(event);
     }
     return NOT_PROCESSED;
 }
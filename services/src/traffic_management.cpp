@@ -16,6 +16,7 @@
 #include "traffic_management.h"
 
 #include <cinttypes>
+#include <fstream>
 #include "cellular_data_net_agent.h"
 #include "data_flow_statistics.h"
 #include "net_conn_client.h"
@@ -24,8 +25,11 @@
 namespace OHOS {
 namespace Telephony {
 using namespace NetManagerStandard;
+static constexpr const char *IFACE_STATS_ROOT_PATH = "/sys/class/net/";
+static constexpr const char *TX_PACKETS_NODE = "/statistics/tx_packets";
+static constexpr const char *RX_PACKETS_NODE = "/statistics/rx_packets";
 
-TrafficManagement::TrafficManagement(int32_t slotId) : slotId_(slotId) {}
+TrafficManagement::TrafficManagement(int32_t slotId) : slotId_(slotId), ifaceStatsRootPath_(IFACE_STATS_ROOT_PATH) {}
 
 TrafficManagement::~TrafficManagement() = default;
 
@@ -37,19 +41,53 @@ void TrafficManagement::GetPacketData(int64_t &sendPackets, int64_t &recvPackets
 
 void TrafficManagement::UpdatePacketData()
 {
-    DataFlowStatistics dataState;
     const std::string interfaceName = GetIfaceName();
     if (!interfaceName.empty()) {
-        sendPackets_ = dataState.GetIfaceTxPackets(interfaceName);
-        recvPackets_ = dataState.GetIfaceRxPackets(interfaceName);
+        int64_t sendPackets = 0;
+        int64_t recvPackets = 0;
+        if (ReadIfaceStats(interfaceName, TX_PACKETS_NODE, sendPackets) &&
+            ReadIfaceStats(interfaceName, RX_PACKETS_NODE, recvPackets)) {
+            sendPackets_ = sendPackets;
+            recvPackets_ = recvPackets;
+        } else {
+            DataFlowStatistics dataState;
+            sendPackets_ = dataState.GetIfaceTxPackets(interfaceName);
+            recvPackets_ = dataState.GetIfaceRxPackets(interfaceName);
+        }
     }
     TELEPHONY_LOGD("Slot%{public}d: sendPackets:%{public}" PRId64 " recvPackets:%{public}" PRId64,
         slotId_, sendPackets_, recvPackets_);
 }
 
+void TrafficManagement::SetIfaceStatsRootPath(const std::string &rootPath)
+{
+    ifaceStatsRootPath_ = rootPath;
+}
+
+bool TrafficManagement::ReadIfaceStats(const std::string &ifaceName, const std::string &node, int64_t &value) const
+{
+    if (ifaceName.find('/') != std::string::npos) {
+        return false;
+    }
+    std::ifstream statsFile(ifaceStatsRootPath_ + ifaceName + node);
+    if (!statsFile.is_open()) {
+        return false;
+    }
+    int64_t stats = 0;
+    if (!(statsFile >> stats)) {
+        return false;
+    }
+    value = stats;
+    return true;
+}
+
 std::string TrafficManagement::GetIfaceName()
 {
-    std::string ifaceName = "";
+    // the interface name is cached by the state machine while the internet connection is active
+    std::string ifaceName = CellularDataNetAgent::GetInstance().GetCellIfaceName(slotId_);
+    if (!ifaceName.empty()) {
+        return ifaceName;
+    }
     int32_t netId = CellularDataNetAgent::GetInstance().GetCellNetId(slotId_);
     // LCOV_EXCL_START
     if (netId < 0) {
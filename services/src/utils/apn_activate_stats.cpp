@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "apn_activate_stats.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace Telephony {
+ApnActivateStats::ApnActivateStats(int64_t windowMs)
+    : bucketWidthMs_(std::max<int64_t>(windowMs / BUCKET_COUNT, 1))
+{}
+
+void ApnActivateStats::Add(int64_t nowMs, uint32_t duration, uint32_t reason)
+{
+    int64_t epoch = std::max<int64_t>(nowMs, 0) / bucketWidthMs_;
+    std::lock_guard<std::mutex> lock(mutex_);
+    ExpireBuckets(epoch);
+    TimeBucket &bucket = buckets_[epoch % BUCKET_COUNT];
+    if (bucket.epoch != epoch) {
+        ResetBucket(bucket);
+        bucket.epoch = epoch;
+    }
+    bucket.duration += duration;
+    bucket.actTimes++;
+    totalDuration_ += duration;
+    totalActTimes_++;
+    if (reason == 0) {
+        bucket.actSuccTimes++;
+        totalActSuccTimes_++;
+        return;
+    }
+    AddReason(bucket, reason);
+}
+
+ApnActivateReportInfo ApnActivateStats::GetReportInfo(int64_t nowMs)
+{
+    ApnActivateReportInfo info = {};
+    ReasonCount merged[BUCKET_COUNT * TOP_REASON_COUNT];
+    uint32_t mergedSize = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    ExpireBuckets(std::max<int64_t>(nowMs, 0) / bucketWidthMs_);
+    info.actTimes = totalActTimes_;
+    info.actSuccTimes = totalActSuccTimes_;
+    info.averDuration = totalActSuccTimes_ == 0 ? 0 : static_cast<uint32_t>(totalDuration_ / totalActSuccTimes_);
+    for (const TimeBucket &bucket : buckets_) {
+        if (bucket.epoch < 0) {
+            continue;
+        }
+        for (const ReasonCount &item : bucket.reasons) {
+            if (item.count == 0) {
+                continue;
+            }
+            uint32_t i = 0;
+            while (i < mergedSize && merged[i].reason != item.reason) {
+                i++;
+            }
+            if (i == mergedSize) {
+                merged[mergedSize++] = item;
+            } else {
+                merged[i].count += item.count;
+            }
+        }
+    }
+    lock.unlock();
+    uint32_t topReasonCnt = 0;
+    for (uint32_t i = 0; i < mergedSize; i++) {
+        if (merged[i].count > topReasonCnt || (merged[i].count == topReasonCnt && merged[i].reason < info.topReason)) {
+            info.topReason = merged[i].reason;
+            topReasonCnt = merged[i].count;
+        }
+    }
+    return info;
+}
+
+void ApnActivateStats::ExpireBuckets(int64_t epoch)
+{
+    for (TimeBucket &bucket : buckets_) {
+        if (bucket.epoch >= 0 && (epoch - bucket.epoch >= BUCKET_COUNT || bucket.epoch > epoch)) {
+            ResetBucket(bucket);
+        }
+    }
+}
+
+void ApnActivateStats::ResetBucket(TimeBucket &bucket)
+{
+    totalDuration_ -= bucket.duration;
+    totalActTimes_ -= bucket.actTimes;
+    totalActSuccTimes_ -= bucket.actSuccTimes;
+    bucket = TimeBucket();
+}
+
+void ApnActivateStats::AddReason(TimeBucket &bucket, uint32_t reason)
+{
+    ReasonCount *minItem = &bucket.reasons[0];
+    for (ReasonCount &item : bucket.reasons) {
+        if (item.count != 0 && item.reason == reason) {
+            item.count++;
+            return;
+        }
+        if (item.count < minItem->count) {
+            minItem = &item;
+        }
+    }
+    // keep the most frequent reasons of the bucket, a new reason takes over the least counted one
+    // and starts from its own count, so it can not outrank the reasons that stayed
+    minItem->reason = reason;
+    minItem->count = 1;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include <cinttypes>
+#include <sstream>
 
 #include "cellular_data_utils.h"
 #include "core_manager_inner.h"
@@ -24,11 +25,14 @@ namespace Telephony {
 using namespace NetManagerStandard;
 namespace {
 constexpr int32_t MAX_CAPABILITY_SIZE = 13;
+constexpr uint32_t SUPPLIER_KEY_SLOT_SHIFT = 32;
 }
 
 CellularDataNetAgent::CellularDataNetAgent()
 {
     netSuppliers_.resize(CoreManagerInner::GetInstance().GetMaxSimCount() * MAX_CAPABILITY_SIZE);
+    PublishSupplierIndex();
+    PublishSimIdIndex();
     callBack_ = std::make_unique<NetManagerCallBack>().release();
     tacticsCallBack_ = std::make_unique<NetManagerTacticsCallBack>().release();
     if (callBack_ == nullptr || tacticsCallBack_ == nullptr) {
@@ -40,62 +44,155 @@ CellularDataNetAgent::~CellularDataNetAgent() = default;
 
 bool CellularDataNetAgent::RegisterNetSupplier(const int32_t slotId)
 {
-    bool flag = false;
-    std::unique_lock<std::shared_mutex> lock(netSupplierMutex_);
-    for (NetSupplier &netSupplier : netSuppliers_) {
+    // registration and unregistration are serialized by registerMutex_, only the IPCs run without
+    // netSupplierMutex_ so an unregister can not land between the registration IPCs and PublishSuppliers
+    std::lock_guard<std::mutex> registerLock(registerMutex_);
+    std::vector<NetSupplier> suppliers = CollectSlotSuppliers(slotId);
+    if (suppliers.empty()) {
+        return false;
+    }
+    int32_t simId = CoreManagerInner::GetInstance().GetSimId(slotId);
+    if (simId <= INVALID_SIM_ID) {
+        TELEPHONY_LOGE("Slot%{public}d Invalid simId: %{public}d", slotId, simId);
+        return false;
+    }
+    SetSlotSimId(slotId, simId);
+    for (NetSupplier &netSupplier : suppliers) {
+        netSupplier.simId = simId;
+    }
+    RegisterSuppliersToNetManager(slotId, suppliers);
+    if (suppliers.empty()) {
+        return false;
+    }
+    PublishSuppliers(suppliers);
+    return true;
+}
+
+std::vector<NetSupplier> CellularDataNetAgent::CollectSlotSuppliers(int32_t slotId)
+{
+    std::vector<NetSupplier> suppliers;
+    std::shared_lock<std::shared_mutex> lock(netSupplierMutex_);
+    for (const NetSupplier &netSupplier : netSuppliers_) {
         if (netSupplier.slotId != slotId) {
             continue;
         }
-        auto& netManager = NetConnClient::GetInstance();
         if (netSupplier.capability > NetCap::NET_CAPABILITY_SNSSAI6) {
             TELEPHONY_LOGE("capabilities(%{public}" PRIu64 ") not support", netSupplier.capability);
             continue;
         }
-        int32_t simId = CoreManagerInner::GetInstance().GetSimId(netSupplier.slotId);
-        if (simId <= INVALID_SIM_ID) {
-            TELEPHONY_LOGE("Slot%{public}d Invalid simId: %{public}d", slotId, simId);
-            continue;
-        }
-        std::unique_lock<std::shared_mutex> lock(slotIdSimIdMutex_);
-        slotIdSimId_[slotId] = simId;
-        lock.unlock();
-        std::set<NetCap> netCap { static_cast<NetCap>(netSupplier.capability) };
+        suppliers.push_back(netSupplier);
+    }
+    return suppliers;
+}
+
+void CellularDataNetAgent::RegisterSuppliersToNetManager(int32_t slotId, std::vector<NetSupplier> &suppliers)
+{
+    auto &netManager = NetConnClient::GetInstance();
+    const std::string ident = std::string(IDENT_PREFIX) + std::to_string(suppliers.front().simId);
+    auto it = suppliers.begin();
+    while (it != suppliers.end()) {
+        std::set<NetCap> netCap { static_cast<NetCap>(it->capability) };
         uint32_t supplierId = 0;
-        int32_t result = netManager.RegisterNetSupplier(
-            NetBearType::BEARER_CELLULAR, std::string(IDENT_PREFIX) + std::to_string(simId), netCap, supplierId);
+        int32_t result = netManager.RegisterNetSupplier(NetBearType::BEARER_CELLULAR, ident, netCap, supplierId);
         TELEPHONY_LOGI(
             "Slot%{public}d Register network supplierId: %{public}d,result:%{public}d", slotId, supplierId, result);
-        if (result == NETMANAGER_SUCCESS) {
-            flag = true;
-            netSupplier.supplierId = supplierId;
-            netSupplier.simId = simId;
-            int32_t regCallback = netManager.RegisterNetSupplierCallback(netSupplier.supplierId, callBack_);
-            TELEPHONY_LOGI("Register supplier callback(%{public}d)", regCallback);
-            sptr<NetSupplierInfo> netSupplierInfo = new (std::nothrow) NetSupplierInfo();
-            if (netSupplierInfo != nullptr) {
-                netSupplierInfo->isAvailable_ = false;
-                int32_t updateResult = NetConnClient::GetInstance().UpdateNetSupplierInfo(
-                    netSupplier.supplierId, netSupplierInfo);
-                TELEPHONY_LOGI("Update network result:%{public}d", updateResult);
-                netSupplier.regState = updateResult;
-            }
-            int32_t radioTech = static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_INVALID);
-            CoreManagerInner::GetInstance().GetPsRadioTech(slotId, radioTech);
-            RegisterSlotType(supplierId, radioTech);
-            TELEPHONY_LOGI("RegisterSlotType: supplierId[%{public}d] slotId[%{public}d] radioTech[%{public}d]",
-                supplierId, slotId, radioTech);
+        if (result != NETMANAGER_SUCCESS) {
+            it = suppliers.erase(it);
+            continue;
         }
+        it->supplierId = supplierId;
+        ForgetPushedNetInfo(supplierId);
+        ++it;
+    }
+    // every supplier of the slot starts unavailable with the same radio tech, share the parcel and the query
+    sptr<NetSupplierInfo> netSupplierInfo = new (std::nothrow) NetSupplierInfo();
+    if (netSupplierInfo != nullptr) {
+        netSupplierInfo->isAvailable_ = false;
+    }
+    int32_t radioTech = static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_INVALID);
+    CoreManagerInner::GetInstance().GetPsRadioTech(slotId, radioTech);
+    for (NetSupplier &netSupplier : suppliers) {
+        int32_t regCallback = netManager.RegisterNetSupplierCallback(netSupplier.supplierId, callBack_);
+        TELEPHONY_LOGI("Register supplier callback(%{public}d)", regCallback);
+        if (netSupplierInfo != nullptr) {
+            netSupplier.regState = netManager.UpdateNetSupplierInfo(netSupplier.supplierId, netSupplierInfo);
+            TELEPHONY_LOGI("Update network result:%{public}d", netSupplier.regState);
+        }
+        RegisterSlotType(netSupplier.supplierId, radioTech);
+        TELEPHONY_LOGI("RegisterSlotType: supplierId[%{public}d] slotId[%{public}d] radioTech[%{public}d]",
+            netSupplier.supplierId, slotId, radioTech);
     }
-    return flag;
+}
+
+void CellularDataNetAgent::PublishSuppliers(const std::vector<NetSupplier> &suppliers)
+{
+    std::unique_lock<std::shared_mutex> lock(netSupplierMutex_);
+    for (NetSupplier &netSupplier : netSuppliers_) {
+        auto it = std::find_if(suppliers.begin(), suppliers.end(), [&netSupplier](const NetSupplier &registered) {
+            return registered.slotId == netSupplier.slotId && registered.capability == netSupplier.capability;
+        });
+        if (it == suppliers.end()) {
+            continue;
+        }
+        netSupplier.supplierId = it->supplierId;
+        netSupplier.simId = it->simId;
+        netSupplier.regState = it->regState;
+    }
+    PublishSupplierIndex();
+}
+
+void CellularDataNetAgent::PublishSupplierIndex()
+{
+    // called with netSupplierMutex_ held exclusively
+    auto index = std::make_shared<SupplierIndex>();
+    index->suppliers = netSuppliers_;
+    for (size_t i = 0; i < index->suppliers.size(); i++) {
+        const NetSupplier &netSupplier = index->suppliers[i];
+        index->slotCapabilityIndex.emplace(MakeSupplierKey(netSupplier.slotId, netSupplier.capability), i);
+        index->supplierIdIndex.emplace(netSupplier.supplierId, i);
+    }
+    std::atomic_store(&supplierIndex_, std::shared_ptr<const SupplierIndex>(index));
+}
+
+uint64_t CellularDataNetAgent::MakeSupplierKey(int32_t slotId, uint64_t capability)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(slotId)) << SUPPLIER_KEY_SLOT_SHIFT) |
+        static_cast<uint32_t>(capability);
+}
+
+void CellularDataNetAgent::SetSlotSimId(int32_t slotId, int32_t simId)
+{
+    std::unique_lock<std::shared_mutex> lock(slotIdSimIdMutex_);
+    slotIdSimId_[slotId] = simId;
+    PublishSimIdIndex();
+}
+
+void CellularDataNetAgent::RemoveSlotSimId(int32_t slotId)
+{
+    std::unique_lock<std::shared_mutex> lock(slotIdSimIdMutex_);
+    slotIdSimId_.erase(slotId);
+    PublishSimIdIndex();
+}
+
+void CellularDataNetAgent::PublishSimIdIndex()
+{
+    // called with slotIdSimIdMutex_ held exclusively
+    auto simIdSlotId = std::make_shared<std::unordered_map<int32_t, int32_t>>();
+    for (const auto &item : slotIdSimId_) {
+        simIdSlotId->emplace(item.second, item.first);
+    }
+    std::atomic_store(&simIdSlotId_, std::shared_ptr<const std::unordered_map<int32_t, int32_t>>(simIdSlotId));
 }
 
 void CellularDataNetAgent::UnregisterNetSupplier(const int32_t slotId)
 {
+    std::lock_guard<std::mutex> registerLock(registerMutex_);
     int32_t simId = CoreManagerInner::GetInstance().GetSimId(slotId);
     if (simId <= INVALID_SIM_ID) {
         TELEPHONY_LOGE("Slot%{public}d Invalid simId: %{public}d", slotId, simId);
         return;
     }
+    InvalidateCellNetIdCache(slotId);
     std::shared_lock<std::shared_mutex> lock(netSupplierMutex_);
     for (const NetSupplier &netSupplier : netSuppliers_) {
         if (netSupplier.simId != simId) {
@@ -104,36 +201,46 @@ void CellularDataNetAgent::UnregisterNetSupplier(const int32_t slotId)
         auto& netManager = NetConnClient::GetInstance();
         int32_t result = netManager.UnregisterNetSupplier(netSupplier.supplierId);
         TELEPHONY_LOGI("Slot%{public}d unregister network result:%{public}d", slotId, result);
+        ForgetPushedNetInfo(netSupplier.supplierId);
     }
 }
 
 void CellularDataNetAgent::UnregisterNetSupplierForSimUpdate(const int32_t slotId)
 {
+    std::lock_guard<std::mutex> registerLock(registerMutex_);
+    InvalidateCellNetIdCache(slotId);
     std::unique_lock<std::shared_mutex> lock(netSupplierMutex_);
     for (NetSupplier &netSupplier : netSuppliers_) {
         if (netSupplier.slotId != slotId || netSupplier.simId <= INVALID_SIM_ID) {
             continue;
         }
-        std::unique_lock<std::shared_mutex> lock(slotIdSimIdMutex_);
-        slotIdSimId_.erase(slotId);
-        lock.unlock();
+        RemoveSlotSimId(slotId);
         auto& netManager = NetConnClient::GetInstance();
         int32_t result = netManager.UnregisterNetSupplier(netSupplier.supplierId);
         TELEPHONY_LOGI("Slot%{public}d unregister network result:%{public}d", slotId, result);
+        ForgetPushedNetInfo(netSupplier.supplierId);
         if (result == NETMANAGER_SUCCESS) {
             netSupplier.simId = INVALID_SIM_ID;
         }
     }
+    PublishSupplierIndex();
 }
 
 void CellularDataNetAgent::UnregisterAllNetSupplier()
 {
+    std::lock_guard<std::mutex> registerLock(registerMutex_);
+    InvalidateAllCellNetIdCache();
+    std::unique_lock<std::mutex> pushedLock(pushedNetInfoMutex_);
+    pushedSupplierInfo_.clear();
+    pushedLinkInfo_.clear();
+    pushedLock.unlock();
     std::unique_lock<std::shared_mutex> lock(netSupplierMutex_);
     for (const NetSupplier &netSupplier : netSuppliers_) {
         int32_t result = NetConnClient::GetInstance().UnregisterNetSupplier(netSupplier.supplierId);
         TELEPHONY_LOGI("Unregister network result:%{public}d", result);
     }
     netSuppliers_.clear();
+    PublishSupplierIndex();
 }
 
 bool CellularDataNetAgent::RegisterPolicyCallback()
@@ -165,48 +272,162 @@ void CellularDataNetAgent::UnregisterPolicyCallback()
 int32_t CellularDataNetAgent::UpdateNetSupplierInfo(
     uint32_t supplierId, sptr<NetManagerStandard::NetSupplierInfo> &netSupplierInfo)
 {
+    PushedSupplierInfo pushedInfo;
+    if (netSupplierInfo != nullptr) {
+        pushedInfo = MakePushedSupplierInfo(*netSupplierInfo);
+        if (IsPushedNetInfo(pushedSupplierInfo_, supplierId, pushedInfo)) {
+            return NETMANAGER_SUCCESS;
+        }
+    }
     int32_t result = NetConnClient::GetInstance().UpdateNetSupplierInfo(supplierId, netSupplierInfo);
     if (result != NETMANAGER_SUCCESS) {
         TELEPHONY_LOGE("Update network fail, result:%{public}d", result);
     }
-    std::unique_lock<std::shared_mutex> lock(netSupplierMutex_);
-    for (NetSupplier &netSupplier : netSuppliers_) {
-        if (netSupplier.supplierId == supplierId) {
-            netSupplier.regState = result;
+    if (netSupplierInfo != nullptr) {
+        std::unique_lock<std::mutex> pushedLock(pushedNetInfoMutex_);
+        if (result == NETMANAGER_SUCCESS) {
+            pushedSupplierInfo_[supplierId] = std::move(pushedInfo);
+        } else {
+            pushedSupplierInfo_.erase(supplierId);
         }
+        if (!netSupplierInfo->isAvailable_) {
+            // the net manager drops the link of an unavailable supplier, the next link must be pushed again
+            pushedLinkInfo_.erase(supplierId);
+        }
+    }
+    if (netSupplierInfo != nullptr && !netSupplierInfo->isAvailable_) {
+        InvalidateCellNetIdCache(FindSupplierSlotId(supplierId));
     }
+    std::shared_ptr<const SupplierIndex> index = std::atomic_load(&supplierIndex_);
+    auto it = index->supplierIdIndex.find(supplierId);
+    // regState is the only indexed field this update touches, an unchanged one needs no new index
+    if (it == index->supplierIdIndex.end() || index->suppliers[it->second].regState == result) {
+        return result;
+    }
+    std::unique_lock<std::shared_mutex> lock(netSupplierMutex_);
+    index = std::atomic_load(&supplierIndex_);
+    it = index->supplierIdIndex.find(supplierId);
+    if (it == index->supplierIdIndex.end() || it->second >= netSuppliers_.size() ||
+        netSuppliers_[it->second].supplierId != supplierId || netSuppliers_[it->second].regState == result) {
+        return result;
+    }
+    netSuppliers_[it->second].regState = result;
+    PublishSupplierIndex();
     return result;
 }
 
 void CellularDataNetAgent::UpdateNetLinkInfo(int32_t supplierId, sptr<NetManagerStandard::NetLinkInfo> &netLinkInfo)
 {
+    uint32_t id = static_cast<uint32_t>(supplierId);
+    PushedLinkInfo pushedInfo;
+    if (netLinkInfo != nullptr) {
+        pushedInfo = MakePushedLinkInfo(*netLinkInfo);
+        if (IsPushedNetInfo(pushedLinkInfo_, id, pushedInfo)) {
+            return;
+        }
+    }
     int32_t result = NetConnClient::GetInstance().UpdateNetLinkInfo(supplierId, netLinkInfo);
     TELEPHONY_LOGD("result:%{public}d", result);
+    if (result == NETMANAGER_SUCCESS) {
+        if (netLinkInfo != nullptr) {
+            std::lock_guard<std::mutex> pushedLock(pushedNetInfoMutex_);
+            pushedLinkInfo_[id] = std::move(pushedInfo);
+        }
+        ArmCellNetIdCache(FindSupplierSlotId(id));
+    }
+}
+
+template<typename T>
+bool CellularDataNetAgent::IsPushedNetInfo(const std::map<uint32_t, T> &pushed, uint32_t supplierId, const T &info)
+{
+    std::lock_guard<std::mutex> pushedLock(pushedNetInfoMutex_);
+    netInfoPushes_++;
+    auto it = pushed.find(supplierId);
+    if (it == pushed.end() || !(it->second == info)) {
+        return false;
+    }
+    suppressedNetInfoPushes_++;
+    TELEPHONY_LOGD("supplierId %{public}u information unchanged, skip the update", supplierId);
+    return true;
+}
+
+void CellularDataNetAgent::ForgetPushedNetInfo(uint32_t supplierId)
+{
+    std::lock_guard<std::mutex> pushedLock(pushedNetInfoMutex_);
+    pushedSupplierInfo_.erase(supplierId);
+    pushedLinkInfo_.erase(supplierId);
+}
+
+bool CellularDataNetAgent::PushedSupplierInfo::operator==(const PushedSupplierInfo &other) const
+{
+    return std::tie(isAvailable, isRoaming, linkUpBandwidthKbps, linkDownBandwidthKbps, score) ==
+        std::tie(other.isAvailable, other.isRoaming, other.linkUpBandwidthKbps, other.linkDownBandwidthKbps,
+        other.score);
+}
+
+bool CellularDataNetAgent::PushedLinkInfo::operator==(const PushedLinkInfo &other) const
+{
+    return std::tie(ifaceName, mtu, tcpBufferSizes, proxyHost, proxyPort, netAddrs, dnsAddrs, routes) ==
+        std::tie(other.ifaceName, other.mtu, other.tcpBufferSizes, other.proxyHost, other.proxyPort,
+        other.netAddrs, other.dnsAddrs, other.routes);
+}
+
+CellularDataNetAgent::PushedSupplierInfo CellularDataNetAgent::MakePushedSupplierInfo(
+    const NetSupplierInfo &netSupplierInfo)
+{
+    PushedSupplierInfo pushedInfo;
+    pushedInfo.isAvailable = netSupplierInfo.isAvailable_;
+    pushedInfo.isRoaming = netSupplierInfo.isRoaming_;
+    pushedInfo.linkUpBandwidthKbps = netSupplierInfo.linkUpBandwidthKbps_;
+    pushedInfo.linkDownBandwidthKbps = netSupplierInfo.linkDownBandwidthKbps_;
+    pushedInfo.score = netSupplierInfo.score_;
+    return pushedInfo;
+}
+
+CellularDataNetAgent::PushedLinkInfo CellularDataNetAgent::MakePushedLinkInfo(const NetLinkInfo &netLinkInfo)
+{
+    PushedLinkInfo pushedInfo;
+    pushedInfo.ifaceName = netLinkInfo.ifaceName_;
+    pushedInfo.mtu = netLinkInfo.mtu_;
+    pushedInfo.tcpBufferSizes = netLinkInfo.tcpBufferSizes_;
+    pushedInfo.proxyHost = netLinkInfo.httpProxy_.GetHost();
+    pushedInfo.proxyPort = netLinkInfo.httpProxy_.GetPort();
+    for (const INetAddr &netAddr : netLinkInfo.netAddrList_) {
+        pushedInfo.netAddrs.emplace_back(netAddr.address_, static_cast<int32_t>(netAddr.prefixlen_));
+    }
+    for (const INetAddr &dnsAddr : netLinkInfo.dnsList_) {
+        pushedInfo.dnsAddrs.push_back(dnsAddr.address_);
+    }
+    for (const Route &route : netLinkInfo.routeList_) {
+        pushedInfo.routes.emplace_back(route.iface_, route.destination_.address_, route.gateway_.address_);
+    }
+    return pushedInfo;
 }
 
 void CellularDataNetAgent::AddNetSupplier(const NetSupplier &netSupplier)
 {
     std::unique_lock<std::shared_mutex> lock(netSupplierMutex_);
     netSuppliers_.push_back(netSupplier);
+    PublishSupplierIndex();
 }
 
 void CellularDataNetAgent::ClearNetSupplier()
 {
     std::unique_lock<std::shared_mutex> lock(netSupplierMutex_);
     netSuppliers_.clear();
+    PublishSupplierIndex();
 }
 
 int32_t CellularDataNetAgent::GetSupplierId(const int32_t slotId, uint64_t capability)
 {
-    std::shared_lock<std::shared_mutex> lock(netSupplierMutex_);
-    for (const NetSupplier &netSupplier : netSuppliers_) {
-        if (netSupplier.slotId == slotId && netSupplier.capability == capability) {
-            TELEPHONY_LOGD(
-                "find supplierId %{public}d capability:%{public}" PRIu64 "", netSupplier.supplierId, capability);
-            return netSupplier.supplierId;
-        }
+    std::shared_ptr<const SupplierIndex> index = std::atomic_load(&supplierIndex_);
+    auto it = index->slotCapabilityIndex.find(MakeSupplierKey(slotId, capability));
+    if (it == index->slotCapabilityIndex.end()) {
+        return 0;
     }
-    return 0;
+    const NetSupplier &netSupplier = index->suppliers[it->second];
+    TELEPHONY_LOGD("find supplierId %{public}d capability:%{public}" PRIu64 "", netSupplier.supplierId, capability);
+    return netSupplier.supplierId;
 }
 
 void CellularDataNetAgent::RegisterSlotType(int32_t supplierId, int32_t radioTech)
@@ -217,12 +438,10 @@ void CellularDataNetAgent::RegisterSlotType(int32_t supplierId, int32_t radioTec
 
 bool CellularDataNetAgent::GetSupplierRegState(uint32_t supplierId, int32_t &regState)
 {
-    std::shared_lock<std::shared_mutex> lock(netSupplierMutex_);
-    auto it = std::find_if(netSuppliers_.begin(), netSuppliers_.end(), [supplierId](const auto &netSupplier) {
-        return netSupplier.supplierId == supplierId;
-    });
-    if (it != netSuppliers_.end()) {
-        regState = it->regState;
+    std::shared_ptr<const SupplierIndex> index = std::atomic_load(&supplierIndex_);
+    auto it = index->supplierIdIndex.find(supplierId);
+    if (it != index->supplierIdIndex.end()) {
+        regState = index->suppliers[it->second].regState;
         return true;
     } else {
         TELEPHONY_LOGE("not find the supplier, supplierId = %{public}d", supplierId);
@@ -238,16 +457,40 @@ void CellularDataNetAgent::SetReuseSupplierId(int32_t supplierId, int32_t reuseS
 
 int32_t CellularDataNetAgent::GetSlotId(int32_t simId)
 {
-    std::shared_lock<std::shared_mutex> lock(slotIdSimIdMutex_);
-    for (auto &item : slotIdSimId_) {
-        if (item.second == simId) {
-            return item.first;
-        }
+    std::shared_ptr<const std::unordered_map<int32_t, int32_t>> simIdSlotId = std::atomic_load(&simIdSlotId_);
+    auto it = simIdSlotId->find(simId);
+    if (it == simIdSlotId->end()) {
+        return -1;
     }
-    return -1;
+    return it->second;
 }
 
 int32_t CellularDataNetAgent::GetCellNetId(int32_t slotId)
+{
+    std::shared_lock<std::shared_mutex> readLock(cellNetIdMutex_);
+    auto it = cellNetId_.find(slotId);
+    if (it != cellNetId_.end() && it->second >= 0) {
+        netIdCacheHits_++;
+        return it->second;
+    }
+    uint64_t generation = GetCellNetIdGeneration(slotId);
+    readLock.unlock();
+    netIdCacheMisses_++;
+    int32_t netId = QueryCellNetId(slotId);
+    if (netId < 0) {
+        return netId;
+    }
+    std::unique_lock<std::shared_mutex> writeLock(cellNetIdMutex_);
+    // only cache while the link is reported and nothing re-armed or dropped the slot during the query,
+    // a net left from a previous connection must not be kept
+    it = cellNetId_.find(slotId);
+    if (it != cellNetId_.end() && GetCellNetIdGeneration(slotId) == generation) {
+        it->second = netId;
+    }
+    return netId;
+}
+
+int32_t CellularDataNetAgent::QueryCellNetId(int32_t slotId)
 {
     int32_t netId = -1;
     int32_t simId = CoreManagerInner::GetInstance().GetSimId(slotId);
@@ -275,11 +518,98 @@ int32_t CellularDataNetAgent::GetCellNetId(int32_t slotId)
     // LCOV_EXCL_STOP
     return netId;
 }
- 
+
 void CellularDataNetAgent::NetDetection(int32_t netId)
 {
     NetManagerStandard::NetHandle netHandle(netId);
     (void)NetConnClient::GetInstance().NetDetection(netHandle);
 }
+
+void CellularDataNetAgent::SetCellIfaceName(int32_t slotId, const std::string &ifaceName)
+{
+    std::unique_lock<std::shared_mutex> lock(cellIfaceNameMutex_);
+    if (ifaceName.empty()) {
+        cellIfaceName_.erase(slotId);
+        lock.unlock();
+        InvalidateCellNetIdCache(slotId);
+        return;
+    }
+    cellIfaceName_[slotId] = ifaceName;
+}
+
+std::string CellularDataNetAgent::GetCellIfaceName(int32_t slotId)
+{
+    std::shared_lock<std::shared_mutex> lock(cellIfaceNameMutex_);
+    auto it = cellIfaceName_.find(slotId);
+    if (it == cellIfaceName_.end()) {
+        return "";
+    }
+    return it->second;
+}
+
+int32_t CellularDataNetAgent::FindSupplierSlotId(uint32_t supplierId)
+{
+    std::shared_ptr<const SupplierIndex> index = std::atomic_load(&supplierIndex_);
+    auto it = index->supplierIdIndex.find(supplierId);
+    if (it == index->supplierIdIndex.end()) {
+        return INVALID_SLOT_ID;
+    }
+    return index->suppliers[it->second].slotId;
+}
+
+void CellularDataNetAgent::ArmCellNetIdCache(int32_t slotId)
+{
+    if (slotId == INVALID_SLOT_ID) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> lock(cellNetIdMutex_);
+    if (cellNetId_.emplace(slotId, -1).second) {
+        cellNetIdGeneration_[slotId]++;
+    }
+}
+
+uint64_t CellularDataNetAgent::GetCellNetIdGeneration(int32_t slotId) const
+{
+    auto it = cellNetIdGeneration_.find(slotId);
+    return it == cellNetIdGeneration_.end() ? 0 : it->second;
+}
+
+void CellularDataNetAgent::InvalidateCellNetIdCache(int32_t slotId)
+{
+    std::unique_lock<std::shared_mutex> lock(cellNetIdMutex_);
+    cellNetIdGeneration_[slotId]++;
+    if (cellNetId_.erase(slotId) > 0) {
+        netIdCacheInvalidations_++;
+    }
+}
+
+void CellularDataNetAgent::InvalidateAllCellNetIdCache()
+{
+    std::unique_lock<std::shared_mutex> lock(cellNetIdMutex_);
+    netIdCacheInvalidations_ += cellNetId_.size();
+    cellNetId_.clear();
+    for (auto &item : cellNetIdGeneration_) {
+        item.second++;
+    }
+}
+
+std::string CellularDataNetAgent::GetNetInfoPushDump()
+{
+    std::ostringstream oss;
+    oss << "updates:" << netInfoPushes_.load() << " unchanged:" << suppressedNetInfoPushes_.load();
+    return oss.str();
+}
+
+std::string CellularDataNetAgent::GetCellNetIdCacheDump()
+{
+    std::ostringstream oss;
+    oss << "hits:" << netIdCacheHits_.load() << " misses:" << netIdCacheMisses_.load()
+        << " invalidations:" << netIdCacheInvalidations_.load();
+    std::shared_lock<std::shared_mutex> lock(cellNetIdMutex_);
+    for (const auto &item : cellNetId_) {
+        oss << " slot" << item.first << ":" << item.second;
+    }
+    return oss.str();
+}
 } // namespace Telephony
 } // namespace OHOS
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_data_perf_stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr uint32_t PERF_SUB_BUCKET_BITS = 2;
+constexpr uint32_t PERF_SUB_BUCKET_COUNT = 1 << PERF_SUB_BUCKET_BITS;
+constexpr uint32_t PERF_HISTOGRAM_BUCKETS = 96;
+constexpr uint32_t PERF_TABLE_CAPACITY = 64;
+constexpr uint32_t PERF_MAX_BIT_INDEX = 63;
+constexpr uint32_t PERF_SLOT_SHIFT = 32;
+constexpr uint32_t PERF_COMPONENT_SHIFT = 48;
+constexpr uint64_t PERF_SLOT_MASK = 0xFFFF;
+constexpr uint64_t PERF_COMPONENT_MASK = 0x7FFF;
+constexpr uint64_t PERF_EVENT_ID_MASK = 0xFFFFFFFF;
+constexpr uint64_t PERF_KEY_VALID_FLAG = 1ULL << 63;
+constexpr uint64_t PERF_HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+constexpr double PERF_P50 = 0.5;
+constexpr double PERF_P99 = 0.99;
+const char *const PERF_COMPONENT_NAMES[] = { "Handler", "Controller", "Monitor", "StateMachine" };
+
+struct PerfHistogram {
+    std::atomic<uint32_t> buckets[PERF_HISTOGRAM_BUCKETS] = {};
+    std::atomic<uint64_t> count { 0 };
+    std::atomic<uint64_t> max { 0 };
+
+    void Add(uint64_t value)
+    {
+        uint32_t index = CellularDataPerfStats::GetBucketIndex(value);
+        // only the owner thread writes, relaxed load and store keep it wait-free
+        buckets[index].store(buckets[index].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (value > max.load(std::memory_order_relaxed)) {
+            max.store(value, std::memory_order_relaxed);
+        }
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+};
+
+struct PerfEntry {
+    std::atomic<uint64_t> key { 0 };
+    PerfHistogram queueDelay;
+    PerfHistogram handleTime;
+};
+
+struct PerfThreadTable {
+    PerfEntry entries[PERF_TABLE_CAPACITY];
+    std::atomic<uint64_t> droppedCount { 0 };
+};
+
+struct MergedHistogram {
+    uint64_t buckets[PERF_HISTOGRAM_BUCKETS] = {};
+    uint64_t count = 0;
+    uint64_t max = 0;
+
+    void Merge(const PerfHistogram &histogram)
+    {
+        count += histogram.count.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+            buckets[i] += histogram.buckets[i].load(std::memory_order_relaxed);
+        }
+        max = std::max(max, histogram.max.load(std::memory_order_relaxed));
+    }
+
+    void Add(uint64_t value)
+    {
+        buckets[CellularDataPerfStats::GetBucketIndex(value)]++;
+        max = std::max(max, value);
+        count++;
+    }
+
+    uint64_t GetPercentile(double percentile) const
+    {
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+            total += buckets[i];
+        }
+        if (total == 0) {
+            return 0;
+        }
+        uint64_t target = static_cast<uint64_t>(percentile * static_cast<double>(total - 1)) + 1;
+        uint64_t accumulated = 0;
+        for (uint32_t i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+            accumulated += buckets[i];
+            if (accumulated >= target) {
+                // upper bound of the bucket, never larger than the observed max
+                uint64_t upper = (i + 1 < PERF_HISTOGRAM_BUCKETS) ?
+                    CellularDataPerfStats::GetBucketLowerBound(i + 1) - 1 : max;
+                return std::min(upper, max);
+            }
+        }
+        return max;
+    }
+};
+
+struct PdnBringUpStats {
+    MergedHistogram bringUpTime;
+    uint32_t lastApnCount = 0;
+    uint64_t lastBringUpUs = 0;
+};
+
+std::mutex g_perfTablesMutex;
+std::vector<std::shared_ptr<PerfThreadTable>> g_perfTables;
+// written once per attach, a lock is cheap enough here
+std::mutex g_pdnBringUpMutex;
+std::map<int32_t, PdnBringUpStats> g_pdnBringUpStats;
+
+PerfThreadTable &GetThreadTable()
+{
+    thread_local std::shared_ptr<PerfThreadTable> table = [] {
+        auto newTable = std::make_shared<PerfThreadTable>();
+        std::lock_guard<std::mutex> lock(g_perfTablesMutex);
+        g_perfTables.push_back(newTable);
+        return newTable;
+    }();
+    return *table;
+}
+
+PerfEntry *FindOrCreateEntry(PerfThreadTable &table, uint64_t key)
+{
+    uint32_t index = static_cast<uint32_t>((key * PERF_HASH_MULTIPLIER) >> PERF_SLOT_SHIFT) % PERF_TABLE_CAPACITY;
+    for (uint32_t i = 0; i < PERF_TABLE_CAPACITY; i++) {
+        PerfEntry &entry = table.entries[(index + i) % PERF_TABLE_CAPACITY];
+        uint64_t entryKey = entry.key.load(std::memory_order_relaxed);
+        if (entryKey == key) {
+            return &entry;
+        }
+        if (entryKey == 0) {
+            entry.key.store(key, std::memory_order_release);
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t MakeKey(PerfComponent component, int32_t slotId, uint32_t eventId)
+{
+    uint64_t slot = static_cast<uint64_t>(static_cast<uint16_t>(slotId)) & PERF_SLOT_MASK;
+    return PERF_KEY_VALID_FLAG | (static_cast<uint64_t>(component) << PERF_COMPONENT_SHIFT) |
+        (slot << PERF_SLOT_SHIFT) | (static_cast<uint64_t>(eventId) & PERF_EVENT_ID_MASK);
+}
+
+void AppendHistogram(std::string &result, const char *name, const MergedHistogram &histogram)
+{
+    result.append(" ");
+    result.append(name);
+    result.append(" p50:");
+    result.append(std::to_string(histogram.GetPercentile(PERF_P50)));
+    result.append(" p99:");
+    result.append(std::to_string(histogram.GetPercentile(PERF_P99)));
+    result.append(" max:");
+    result.append(std::to_string(histogram.max));
+}
+} // namespace
+
+uint32_t CellularDataPerfStats::GetBucketIndex(uint64_t value)
+{
+    if (value < PERF_SUB_BUCKET_COUNT) {
+        return static_cast<uint32_t>(value);
+    }
+    uint32_t exponent = PERF_MAX_BIT_INDEX - static_cast<uint32_t>(__builtin_clzll(value));
+    uint32_t subBucket = static_cast<uint32_t>(value >> (exponent - PERF_SUB_BUCKET_BITS)) &
+        (PERF_SUB_BUCKET_COUNT - 1);
+    uint32_t index = (exponent - PERF_SUB_BUCKET_BITS + 1) * PERF_SUB_BUCKET_COUNT + subBucket;
+    return std::min(index, PERF_HISTOGRAM_BUCKETS - 1);
+}
+
+uint64_t CellularDataPerfStats::GetBucketLowerBound(uint32_t index)
+{
+    if (index < PERF_SUB_BUCKET_COUNT) {
+        return index;
+    }
+    uint32_t exponent = index / PERF_SUB_BUCKET_COUNT + PERF_SUB_BUCKET_BITS - 1;
+    uint64_t subBucket = index % PERF_SUB_BUCKET_COUNT;
+    return (PERF_SUB_BUCKET_COUNT + subBucket) << (exponent - PERF_SUB_BUCKET_BITS);
+}
+
+void CellularDataPerfStats::Record(PerfComponent component, int32_t slotId, uint32_t eventId,
+    int64_t queueDelayUs, int64_t handleTimeUs)
+{
+    PerfThreadTable &table = GetThreadTable();
+    PerfEntry *entry = FindOrCreateEntry(table, MakeKey(component, slotId, eventId));
+    if (entry == nullptr) {
+        table.droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    entry->queueDelay.Add(static_cast<uint64_t>(std::max<int64_t>(queueDelayUs, 0)));
+    entry->handleTime.Add(static_cast<uint64_t>(std::max<int64_t>(handleTimeUs, 0)));
+}
+
+void CellularDataPerfStats::RecordPdnBringUp(int32_t slotId, uint32_t apnCount, int64_t bringUpUs)
+{
+    uint64_t value = static_cast<uint64_t>(std::max<int64_t>(bringUpUs, 0));
+    std::lock_guard<std::mutex> lock(g_pdnBringUpMutex);
+    PdnBringUpStats &stats = g_pdnBringUpStats[slotId];
+    stats.bringUpTime.Add(value);
+    stats.lastApnCount = apnCount;
+    stats.lastBringUpUs = value;
+}
+
+std::string CellularDataPerfStats::Dump()
+{
+    std::map<uint64_t, std::pair<MergedHistogram, MergedHistogram>> merged;
+    uint64_t droppedCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_perfTablesMutex);
+        for (const auto &table : g_perfTables) {
+            for (const PerfEntry &entry : table->entries) {
+                uint64_t key = entry.key.load(std::memory_order_acquire);
+                if (key == 0) {
+                    continue;
+                }
+                auto &histograms = merged[key];
+                histograms.first.Merge(entry.queueDelay);
+                histograms.second.Merge(entry.handleTime);
+            }
+            droppedCount += table->droppedCount.load(std::memory_order_relaxed);
+        }
+    }
+    std::string result;
+    for (const auto &[key, histograms] : merged) {
+        uint32_t component = static_cast<uint32_t>((key >> PERF_COMPONENT_SHIFT) & PERF_COMPONENT_MASK);
+        int32_t slotId = static_cast<int16_t>((key >> PERF_SLOT_SHIFT) & PERF_SLOT_MASK);
+        result.append(component < static_cast<uint32_t>(PerfComponent::COMPONENT_COUNT) ?
+            PERF_COMPONENT_NAMES[component] : "Unknown");
+        result.append(" slot:");
+        result.append(std::to_string(slotId));
+        result.append(" event:");
+        result.append(std::to_string(key & PERF_EVENT_ID_MASK));
+        result.append(" count:");
+        result.append(std::to_string(histograms.second.count));
+        AppendHistogram(result, "queueUs", histograms.first);
+        AppendHistogram(result, "handleUs", histograms.second);
+        result.append("\n");
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_pdnBringUpMutex);
+        for (const auto &[slotId, stats] : g_pdnBringUpStats) {
+            result.append("PdnBringUp slot:");
+            result.append(std::to_string(slotId));
+            result.append(" count:");
+            result.append(std::to_string(stats.bringUpTime.count));
+            result.append(" lastApns:");
+            result.append(std::to_string(stats.lastApnCount));
+            result.append(" lastUs:");
+            result.append(std::to_string(stats.lastBringUpUs));
+            AppendHistogram(result, "bringUpUs", stats.bringUpTime);
+            result.append("\n");
+        }
+    }
+    result.append("dropped:");
+    result.append(std::to_string(droppedCount));
+    result.append("\n");
+    return result;
+}
+
+CellularDataPerfScope::CellularDataPerfScope(PerfComponent component, int32_t slotId,
+    const AppExecFwk::InnerEvent::Pointer &event)
+    : component_(component), slotId_(slotId), beginTime_(std::chrono::steady_clock::now())
+{
+    if (event == nullptr) {
+        return;
+    }
+    eventId_ = event->GetInnerEventId();
+    queueDelayUs_ = std::chrono::duration_cast<std::chrono::microseconds>(beginTime_ - event->GetHandleTime()).count();
+}
+
+CellularDataPerfScope::~CellularDataPerfScope()
+{
+    int64_t handleTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - beginTime_).count();
+    CellularDataPerfStats::Record(component_, slotId_, eventId_, queueDelayUs_, handleTimeUs);
+}
+} // namespace Telephony
+} // namespace OHOS
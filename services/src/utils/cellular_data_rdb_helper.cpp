@@ -14,6 +14,12 @@
  */
 
 #include "cellular_data_rdb_helper.h"
+
+#include <cinttypes>
+#include <sstream>
+
+#include "ability_connect_callback_stub.h"
+#include "ability_manager_client.h"
 #include "cellular_data_hisysevent.h"
 #include "core_manager_inner.h"
 #include "core_service_client.h"
@@ -22,10 +28,40 @@
 static constexpr const char *SIM_ID = "simId";
 namespace OHOS {
 namespace Telephony {
-CellularDataRdbHelper::CellularDataRdbHelper() : cellularDataUri_(CELLULAR_DATA_RDB_SELECTION) {}
+CellularDataRdbHelper::CellularDataRdbHelper()
+    : cellularDataUri_(CELLULAR_DATA_RDB_SELECTION), helperPool_(std::make_shared<DataShareHelperPool>())
+{}
 
 CellularDataRdbHelper::~CellularDataRdbHelper() = default;
 
+namespace {
+// second connection to the pdp profile provider, only used to learn its remote object for the death watch
+class PdpProfileProviderConnection : public AAFwk::AbilityConnectionStub {
+public:
+    PdpProfileProviderConnection(std::weak_ptr<DataShareHelperPool> pool, const DataShare::DataShareHelper *helper)
+        : pool_(std::move(pool)), helper_(helper)
+    {}
+    ~PdpProfileProviderConnection() override = default;
+
+    void OnAbilityConnectDone(const AppExecFwk::ElementName &element, const sptr<IRemoteObject> &remoteObject,
+        int resultCode) override
+    {
+        auto pool = pool_.lock();
+        if (resultCode != ERR_OK || pool == nullptr) {
+            TELEPHONY_LOGE("connect pdp profile provider failed %{public}d", resultCode);
+            return;
+        }
+        pool->WatchRemote(helper_, remoteObject);
+    }
+
+    void OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode) override {}
+
+private:
+    std::weak_ptr<DataShareHelperPool> pool_;
+    const DataShare::DataShareHelper *helper_;
+};
+} // namespace
+
 std::shared_ptr<DataShare::DataShareHelper> CellularDataRdbHelper::CreateDataAbilityHelper(const int waitTime)
 {
     TELEPHONY_LOGI("Create data ability helper");
@@ -49,36 +85,82 @@ std::shared_ptr<DataShare::DataShareHelper> CellularDataRdbHelper::CreateDataAbi
     return resPair.second;
 }
 
+std::shared_ptr<DataShare::DataShareHelper> CellularDataRdbHelper::WatchPdpProfileProvider(
+    const std::shared_ptr<DataShare::DataShareHelper> &helper)
+{
+    // the helper does not expose the provider proxy, it is delivered asynchronously by an own connection
+    sptr<PdpProfileProviderConnection> connection =
+        new (std::nothrow) PdpProfileProviderConnection(helperPool_, helper.get());
+    if (connection == nullptr) {
+        return helper;
+    }
+    AAFwk::Want want;
+    want.SetUri(CELLULAR_DATA_RDB_URI);
+    ErrCode ret = AAFwk::AbilityManagerClient::GetInstance()->ConnectDataShareExtensionAbility(want, connection);
+    if (ret != ERR_OK) {
+        TELEPHONY_LOGE("watch pdp profile provider failed %{public}d", ret);
+        return helper;
+    }
+    // the watch connection lives exactly as long as the helper it watches
+    return std::shared_ptr<DataShare::DataShareHelper>(helper.get(),
+        [helper, connection](DataShare::DataShareHelper *) {
+            AAFwk::AbilityManagerClient::GetInstance()->DisconnectAbility(connection);
+        });
+}
+
+std::shared_ptr<DataShare::DataShareHelper> CellularDataRdbHelper::AcquireDataAbilityHelper(const int waitTime)
+{
+    return helperPool_->Acquire(
+        [this, waitTime](sptr<IRemoteObject> &) -> std::shared_ptr<DataShare::DataShareHelper> {
+            std::shared_ptr<DataShare::DataShareHelper> helper = CreateDataAbilityHelper(waitTime);
+            if (helper == nullptr) {
+                return nullptr;
+            }
+            return WatchPdpProfileProvider(helper);
+        });
+}
+
+std::string CellularDataRdbHelper::GetHelperPoolDump()
+{
+    return helperPool_->GetDump();
+}
+
 int CellularDataRdbHelper::Update(
     const DataShare::DataShareValuesBucket &value, const DataShare::DataSharePredicates &predicates)
 {
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("dataShareHelper is null");
         return NULL_POINTER_EXCEPTION;
     }
     TELEPHONY_LOGI("Cellular data RDB helper update");
     int32_t result = dataShareHelper->Update(cellularDataUri_, predicates, value);
-    dataShareHelper->Release();
+    if (result < TELEPHONY_ERR_SUCCESS) {
+        helperPool_->Invalidate();
+    }
+    InvalidateApnCache();
     return result;
 }
 
 int CellularDataRdbHelper::Insert(const DataShare::DataShareValuesBucket &values)
 {
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("dataShareHelper is null");
         return NULL_POINTER_EXCEPTION;
     }
     TELEPHONY_LOGI("Cellular data RDB helper insert");
     int32_t result = dataShareHelper->Insert(cellularDataUri_, values);
-    dataShareHelper->Release();
+    if (result < TELEPHONY_ERR_SUCCESS) {
+        helperPool_->Invalidate();
+    }
+    InvalidateApnCache();
     return result;
 }
 
 bool CellularDataRdbHelper::ResetApns(int32_t slotId)
 {
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("dataShareHelper is null");
         return false;
@@ -90,7 +172,10 @@ bool CellularDataRdbHelper::ResetApns(int32_t slotId)
     DataShare::DataShareValuesBucket values;
     values.Put(SIM_ID, simId);
     int32_t result = dataShareHelper->Update(resetApnUri, predicates, values);
-    dataShareHelper->Release();
+    if (result < TELEPHONY_ERR_SUCCESS) {
+        helperPool_->Invalidate();
+    }
+    InvalidateApnCache();
     return result >= 0;
 }
 
@@ -98,7 +183,13 @@ bool CellularDataRdbHelper::QueryApns(
     const std::string &mcc, const std::string &mnc, std::vector<PdpProfile> &apnVec, int32_t slotId,
     std::string &errMsg)
 {
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper(DB_CONNECT_MAX_WAIT_TIME);
+    int32_t simId = CoreManagerInner::GetInstance().GetSimId(slotId);
+    std::string cacheKey = MakeApnCacheKey(simId, mcc + mnc, "");
+    if (GetCachedApns(cacheKey, apnVec)) {
+        return true;
+    }
+    uint64_t cacheVersion = GetApnCacheVersion();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper(DB_CONNECT_MAX_WAIT_TIME);
     // LCOV_EXCL_START
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("dataShareHelper is null");
@@ -109,65 +200,83 @@ bool CellularDataRdbHelper::QueryApns(
     std::vector<std::string> columns;
     DataShare::DataSharePredicates predicates;
     predicates.EqualTo(PdpProfileData::MCCMNC, mcc + mnc);
-    int32_t simId = CoreManagerInner::GetInstance().GetSimId(slotId);
     Uri cellularDataUri(std::string(CELLULAR_DATA_RDB_SELECTION) + "?simId=" + std::to_string(simId));
     std::shared_ptr<DataShare::DataShareResultSet> result =
         dataShareHelper->Query(cellularDataUri, predicates, columns);
     // LCOV_EXCL_START
     if (result == nullptr) {
         TELEPHONY_LOGE("query apns error");
-        dataShareHelper->Release();
+        helperPool_->Invalidate();
         errMsg = "query apns error";
         return false;
     }
     // LCOV_EXCL_STOP
-    ReadApnResult(result, apnVec);
+    std::vector<PdpProfile> queryApnVec;
+    ReadApnResult(result, queryApnVec);
     // LCOV_EXCL_START
-    if (apnVec.size() == 0) {
+    if (queryApnVec.size() == 0) {
         TELEPHONY_LOGE("read apn result empty");
         errMsg = "read apn result empty";
+    } else {
+        PutCachedApns(cacheKey, cacheVersion, queryApnVec);
     }
     // LCOV_EXCL_STOP
+    apnVec.insert(apnVec.end(), queryApnVec.begin(), queryApnVec.end());
     result->Close();
-    dataShareHelper->Release();
     return true;
 }
 
-bool CellularDataRdbHelper::QueryMvnoApnsByType(const std::string &mcc, const std::string &mnc,
-    const std::string &mvnoType, const std::string &mvnoDataFromSim, std::vector<PdpProfile> &mvnoApnVec,
+bool CellularDataRdbHelper::QueryMvnoApns(const std::string &mcc, const std::string &mnc,
+    const std::vector<std::pair<std::string, std::string>> &mvnoDataFromSim, std::vector<PdpProfile> &mvnoApnVec,
     int32_t slotId)
 {
-    if (mvnoDataFromSim.empty()) {
+    std::vector<std::string> mvnoTypes;
+    std::string mvnoKey;
+    for (const auto &[mvnoType, mvnoData] : mvnoDataFromSim) {
+        if (mvnoData.empty()) {
+            continue;
+        }
+        mvnoTypes.push_back(mvnoType);
+        mvnoKey.append(mvnoType).append(":").append(mvnoData).append(";");
+    }
+    if (mvnoTypes.empty()) {
         TELEPHONY_LOGE("mvnoDataFromSim is empty!");
         return true;
     }
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    int32_t simId = CoreManagerInner::GetInstance().GetSimId(slotId);
+    std::string cacheKey = MakeApnCacheKey(simId, mcc + mnc, mvnoKey);
+    if (GetCachedApns(cacheKey, mvnoApnVec)) {
+        return true;
+    }
+    uint64_t cacheVersion = GetApnCacheVersion();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("dataShareHelper is null");
         return false;
     }
     std::vector<std::string> columns;
     DataShare::DataSharePredicates predicates;
-    predicates.EqualTo(PdpProfileData::MVNO_TYPE, mvnoType)
+    predicates.In(PdpProfileData::MVNO_TYPE, mvnoTypes)
         ->EqualTo(PdpProfileData::MCCMNC, mcc + mnc);
-    int32_t simId = CoreManagerInner::GetInstance().GetSimId(slotId);
     Uri cellularDataUri(std::string(CELLULAR_DATA_RDB_SELECTION) + "?simId=" + std::to_string(simId));
     std::shared_ptr<DataShare::DataShareResultSet> result =
         dataShareHelper->Query(cellularDataUri, predicates, columns);
     if (result == nullptr) {
-        TELEPHONY_LOGE("Query apns error");
-        dataShareHelper->Release();
+        TELEPHONY_LOGE("Query mvno apns error");
+        helperPool_->Invalidate();
         return false;
     }
-    ReadMvnoApnResult(result, mvnoDataFromSim, mvnoApnVec);
+    std::vector<PdpProfile> queryApnVec;
+    ReadMvnoApnResult(result, mvnoDataFromSim, queryApnVec);
+    PutCachedApns(cacheKey, cacheVersion, queryApnVec);
+    mvnoApnVec.insert(mvnoApnVec.end(), queryApnVec.begin(), queryApnVec.end());
     result->Close();
-    dataShareHelper->Release();
     return true;
 }
 
 bool CellularDataRdbHelper::QueryPreferApn(int32_t slotId, std::vector<PdpProfile> &apnVec, const int waitTime)
 {
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper(waitTime);
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper(waitTime);
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("dataShareHelper is null");
         CellularDataHiSysEvent::WriteDataActivateFaultEvent(slotId, SWITCH_ON,
@@ -181,14 +290,13 @@ bool CellularDataRdbHelper::QueryPreferApn(int32_t slotId, std::vector<PdpProfil
     std::shared_ptr<DataShare::DataShareResultSet> result = dataShareHelper->Query(preferApnUri, predicates, columns);
     if (result == nullptr) {
         TELEPHONY_LOGE("query prefer apns error");
-        dataShareHelper->Release();
+        helperPool_->Invalidate();
         CellularDataHiSysEvent::WriteDataActivateFaultEvent(slotId, SWITCH_ON,
             CellularDataErrorCode::DATA_ERROR_APN_QUERY_FAIL, "Query apn fail");
         return false;
     }
     ReadApnResult(result, apnVec);
     result->Close();
-    dataShareHelper->Release();
     if (apnVec.size() <= 0) {
         TELEPHONY_LOGI("simid no set prefer apn");
         CellularDataHiSysEvent::WriteDataActivateFaultEvent(slotId, SWITCH_ON,
@@ -207,12 +315,14 @@ void CellularDataRdbHelper::ReadApnResult(
     int rowCnt = 0;
     result->GetRowCount(rowCnt);
     TELEPHONY_LOGI("query apns rowCnt = %{public}d", rowCnt);
+    PdpProfileColumns columns;
+    GetPdpProfileColumns(result, columns);
     for (int i = 0; i < rowCnt; ++i) {
         PdpProfile apnBean;
-        MakePdpProfile(result, i, apnBean);
+        MakePdpProfile(result, i, columns, apnBean);
         // 对于非MVNO类型或用户编辑的MVNO类型，都添加到列表
         if (apnBean.mvnoType.empty() || apnBean.edited != 0) {
-            apnVec.push_back(apnBean);
+            apnVec.push_back(std::move(apnBean));
         } else {
             TELEPHONY_LOGD("Skip mvno apn: profileId=%{public}d, mvnoType=%{public}s",
                 apnBean.profileId, apnBean.mvnoType.c_str());
@@ -221,7 +331,7 @@ void CellularDataRdbHelper::ReadApnResult(
 }
 
 void CellularDataRdbHelper::ReadMvnoApnResult(const std::shared_ptr<DataShare::DataShareResultSet> &result,
-    const std::string &mvnoDataFromSim, std::vector<PdpProfile> &apnVec)
+    const std::vector<std::pair<std::string, std::string>> &mvnoDataFromSim, std::vector<PdpProfile> &apnVec)
 {
     if (result == nullptr) {
         TELEPHONY_LOGI("result is nullptr");
@@ -230,65 +340,91 @@ void CellularDataRdbHelper::ReadMvnoApnResult(const std::shared_ptr<DataShare::D
     int rowCnt = 0;
     result->GetRowCount(rowCnt);
     TELEPHONY_LOGI("query mvno apns rowCnt = %{public}d", rowCnt);
+    PdpProfileColumns columns;
+    GetPdpProfileColumns(result, columns);
+    // keep the matched profiles grouped in the order of mvnoDataFromSim
+    std::vector<std::vector<PdpProfile>> matchedApnVecs(mvnoDataFromSim.size());
     for (int i = 0; i < rowCnt; ++i) {
         PdpProfile apnBean;
-        MakePdpProfile(result, i, apnBean);
-        if (IsMvnoDataMatched(mvnoDataFromSim, apnBean)) {
-            apnVec.push_back(apnBean);
+        MakePdpProfile(result, i, columns, apnBean);
+        for (size_t j = 0; j < mvnoDataFromSim.size(); ++j) {
+            if (apnBean.mvnoType != mvnoDataFromSim[j].first) {
+                continue;
+            }
+            if (IsMvnoDataMatched(mvnoDataFromSim[j].second, apnBean)) {
+                matchedApnVecs[j].push_back(std::move(apnBean));
+            }
+            break;
         }
     }
+    for (auto &matchedApnVec : matchedApnVecs) {
+        apnVec.insert(apnVec.end(), std::make_move_iterator(matchedApnVec.begin()),
+            std::make_move_iterator(matchedApnVec.end()));
+    }
+}
+
+void CellularDataRdbHelper::GetPdpProfileColumns(
+    const std::shared_ptr<DataShare::DataShareResultSet> &result, PdpProfileColumns &columns)
+{
+    result->GetColumnIndex(PdpProfileData::PROFILE_ID, columns.profileId);
+    result->GetColumnIndex(PdpProfileData::PROFILE_NAME, columns.profileName);
+    result->GetColumnIndex(PdpProfileData::MCC, columns.mcc);
+    result->GetColumnIndex(PdpProfileData::MNC, columns.mnc);
+    result->GetColumnIndex(PdpProfileData::APN, columns.apn);
+    result->GetColumnIndex(PdpProfileData::AUTH_USER, columns.authUser);
+    result->GetColumnIndex(PdpProfileData::AUTH_TYPE, columns.authType);
+    result->GetColumnIndex(PdpProfileData::AUTH_PWD, columns.authPwd);
+    result->GetColumnIndex(PdpProfileData::APN_TYPES, columns.apnTypes);
+    result->GetColumnIndex(PdpProfileData::APN_PROTOCOL, columns.pdpProtocol);
+    result->GetColumnIndex(PdpProfileData::APN_ROAM_PROTOCOL, columns.roamPdpProtocol);
+    result->GetColumnIndex(PdpProfileData::MVNO_TYPE, columns.mvnoType);
+    result->GetColumnIndex(PdpProfileData::MVNO_MATCH_DATA, columns.mvnoMatchData);
+    result->GetColumnIndex(PdpProfileData::EDITED_STATUS, columns.edited);
+    result->GetColumnIndex(PdpProfileData::PROXY_IP_ADDRESS, columns.proxyIpAddress);
+    result->GetColumnIndex(PdpProfileData::HOME_URL, columns.homeUrl);
+    result->GetColumnIndex(PdpProfileData::MMS_IP_ADDRESS, columns.mmsIpAddress);
+    result->GetColumnIndex(PdpProfileData::SERVER, columns.server);
 }
 
 void CellularDataRdbHelper::MakePdpProfile(
     const std::shared_ptr<DataShare::DataShareResultSet> &result, int i, PdpProfile &apnBean)
 {
-    int index = 0;
+    PdpProfileColumns columns;
+    GetPdpProfileColumns(result, columns);
+    MakePdpProfile(result, i, columns, apnBean);
+}
+
+void CellularDataRdbHelper::MakePdpProfile(const std::shared_ptr<DataShare::DataShareResultSet> &result, int i,
+    const PdpProfileColumns &columns, PdpProfile &apnBean)
+{
     result->GoToRow(i);
-    result->GetColumnIndex(PdpProfileData::PROFILE_ID, index);
-    result->GetInt(index, apnBean.profileId);
-    result->GetColumnIndex(PdpProfileData::PROFILE_NAME, index);
-    result->GetString(index, apnBean.profileName);
-    result->GetColumnIndex(PdpProfileData::MCC, index);
-    result->GetString(index, apnBean.mcc);
-    result->GetColumnIndex(PdpProfileData::MNC, index);
-    result->GetString(index, apnBean.mnc);
-    result->GetColumnIndex(PdpProfileData::APN, index);
-    result->GetString(index, apnBean.apn);
-    result->GetColumnIndex(PdpProfileData::AUTH_USER, index);
-    result->GetString(index, apnBean.authUser);
-    result->GetColumnIndex(PdpProfileData::AUTH_TYPE, index);
-    result->GetInt(index, apnBean.authType);
+    result->GetInt(columns.profileId, apnBean.profileId);
+    result->GetString(columns.profileName, apnBean.profileName);
+    result->GetString(columns.mcc, apnBean.mcc);
+    result->GetString(columns.mnc, apnBean.mnc);
+    result->GetString(columns.apn, apnBean.apn);
+    result->GetString(columns.authUser, apnBean.authUser);
+    result->GetInt(columns.authType, apnBean.authType);
     if (apnBean.authType == -1) {
         apnBean.authType = (apnBean.authUser.empty()) ? SETUP_DATA_AUTH_NONE : SETUP_DATA_AUTH_PAP_CHAP;
     }
-    result->GetColumnIndex(PdpProfileData::AUTH_PWD, index);
-    result->GetString(index, apnBean.authPwd);
-    result->GetColumnIndex(PdpProfileData::APN_TYPES, index);
-    result->GetString(index, apnBean.apnTypes);
-    result->GetColumnIndex(PdpProfileData::APN_PROTOCOL, index);
-    result->GetString(index, apnBean.pdpProtocol);
-    result->GetColumnIndex(PdpProfileData::APN_ROAM_PROTOCOL, index);
-    result->GetString(index, apnBean.roamPdpProtocol);
-    result->GetColumnIndex(PdpProfileData::MVNO_TYPE, index);
-    result->GetString(index, apnBean.mvnoType);
-    result->GetColumnIndex(PdpProfileData::MVNO_MATCH_DATA, index);
-    result->GetString(index, apnBean.mvnoMatchData);
-    result->GetColumnIndex(PdpProfileData::EDITED_STATUS, index);
-    result->GetInt(index, apnBean.edited);
-    result->GetColumnIndex(PdpProfileData::PROXY_IP_ADDRESS, index);
-    result->GetString(index, apnBean.proxyIpAddress);
+    result->GetString(columns.authPwd, apnBean.authPwd);
+    result->GetString(columns.apnTypes, apnBean.apnTypes);
+    result->GetString(columns.pdpProtocol, apnBean.pdpProtocol);
+    result->GetString(columns.roamPdpProtocol, apnBean.roamPdpProtocol);
+    result->GetString(columns.mvnoType, apnBean.mvnoType);
+    result->GetString(columns.mvnoMatchData, apnBean.mvnoMatchData);
+    result->GetInt(columns.edited, apnBean.edited);
+    result->GetString(columns.proxyIpAddress, apnBean.proxyIpAddress);
     if (apnBean.pdpProtocol.empty()) {
         apnBean.pdpProtocol = "IP";
     }
     if (apnBean.roamPdpProtocol.empty()) {
         apnBean.roamPdpProtocol = "IP";
     }
-    result->GetColumnIndex(PdpProfileData::HOME_URL, index);
-    result->GetString(index, apnBean.homeUrl);
-    result->GetColumnIndex(PdpProfileData::MMS_IP_ADDRESS, index);
-    result->GetString(index, apnBean.mmsIpAddress);
-    result->GetColumnIndex(PdpProfileData::SERVER, index);
-    result->GetString(index, apnBean.server);
+    result->GetString(columns.homeUrl, apnBean.homeUrl);
+    result->GetString(columns.mmsIpAddress, apnBean.mmsIpAddress);
+    result->GetString(columns.server, apnBean.server);
 }
 
 bool CellularDataRdbHelper::IsMvnoDataMatched(const std::string &mvnoDataFromSim, const PdpProfile &apnBean)
@@ -314,7 +450,7 @@ bool CellularDataRdbHelper::IsMvnoDataMatched(const std::string &mvnoDataFromSim
 
 void CellularDataRdbHelper::RegisterObserver(const sptr<AAFwk::IDataAbilityObserver> &dataObserver)
 {
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("dataShareHelper is null");
         return;
@@ -326,13 +462,12 @@ void CellularDataRdbHelper::RegisterObserver(const sptr<AAFwk::IDataAbilityObser
     dataShareHelper->RegisterObserver(preferApnUri, dataObserver);
     dataShareHelper->RegisterObserver(initApnUri, dataObserver);
     dataShareHelper->RegisterObserver(cellularDataUri_, dataObserver);
-    dataShareHelper->Release();
     TELEPHONY_LOGI("RegisterObserver Success");
 }
 
 void CellularDataRdbHelper::UnRegisterObserver(const sptr<AAFwk::IDataAbilityObserver> &dataObserver)
 {
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("dataShareHelper is null");
         return;
@@ -344,7 +479,6 @@ void CellularDataRdbHelper::UnRegisterObserver(const sptr<AAFwk::IDataAbilityObs
     dataShareHelper->UnregisterObserver(preferApnUri, dataObserver);
     dataShareHelper->UnregisterObserver(initApnUri, dataObserver);
     dataShareHelper->UnregisterObserver(cellularDataUri_, dataObserver);
-    dataShareHelper->Release();
     TELEPHONY_LOGI("UnRegisterObserver Success");
 }
 
@@ -379,7 +513,7 @@ void CellularDataRdbHelper::QueryApnIds(const ApnInfo &apnInfo, std::vector<uint
     if (GetSimId() == -1) {
         return;
     }
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         return;
     }
@@ -407,7 +541,7 @@ void CellularDataRdbHelper::QueryApnIds(const ApnInfo &apnInfo, std::vector<uint
     std::shared_ptr<DataShare::DataShareResultSet> rst = dataShareHelper->Query(cellularDataUri, predicates, columns);
     if (rst == nullptr) {
         TELEPHONY_LOGE("QueryApnIds: query apns error");
-        dataShareHelper->Release();
+        helperPool_->Invalidate();
         return;
     }
     int rowCnt = 0;
@@ -423,7 +557,6 @@ void CellularDataRdbHelper::QueryApnIds(const ApnInfo &apnInfo, std::vector<uint
         apnIdList.push_back(profileId);
     }
     rst->Close();
-    dataShareHelper->Release();
 }
 
 int32_t CellularDataRdbHelper::SetPreferApn(int32_t apnId)
@@ -431,7 +564,7 @@ int32_t CellularDataRdbHelper::SetPreferApn(int32_t apnId)
     if (GetSimId() == -1) {
         return -1;
     }
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("SetPreferApn dataShareHelper is null");
         return -1;
@@ -447,11 +580,10 @@ int32_t CellularDataRdbHelper::SetPreferApn(int32_t apnId)
     int32_t result = dataShareHelper->Update(preferApnUri, predicates, values);
     if (result < TELEPHONY_ERR_SUCCESS) {
         TELEPHONY_LOGE("SetPreferApn fail! result:%{public}d", result);
-        dataShareHelper->Release();
+        helperPool_->Invalidate();
         return -1;
     }
     TELEPHONY_LOGI("SetPreferApn result:%{public}d", result);
-    dataShareHelper->Release();
     return 0;
 }
 
@@ -500,7 +632,7 @@ void CellularDataRdbHelper::QueryAllApnInfo(std::vector<ApnInfo> &apnInfoList)
     if (GetSimId() == -1) {
         return;
     }
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper();
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = AcquireDataAbilityHelper();
     if (dataShareHelper == nullptr) {
         TELEPHONY_LOGE("QueryAllApnInfo dataShareHelper is null");
         return;
@@ -514,7 +646,7 @@ void CellularDataRdbHelper::QueryAllApnInfo(std::vector<ApnInfo> &apnInfoList)
         dataShareHelper->Query(cellularDataUri, predicates, columns);
     if (result == nullptr) {
         TELEPHONY_LOGE("QueryAllApnInfo error");
-        dataShareHelper->Release();
+        helperPool_->Invalidate();
         return;
     }
     int rowCnt = 0;
@@ -526,7 +658,63 @@ void CellularDataRdbHelper::QueryAllApnInfo(std::vector<ApnInfo> &apnInfoList)
         apnInfoList.push_back(apnInfo);
     }
     result->Close();
-    dataShareHelper->Release();
+}
+
+std::string CellularDataRdbHelper::MakeApnCacheKey(
+    int32_t simId, const std::string &mccmnc, const std::string &mvnoKey)
+{
+    return std::to_string(simId) + "|" + mccmnc + "|" + mvnoKey;
+}
+
+bool CellularDataRdbHelper::GetCachedApns(const std::string &key, std::vector<PdpProfile> &apnVec)
+{
+    std::lock_guard<std::mutex> lock(apnCacheMutex_);
+    auto it = apnCache_.find(key);
+    if (it == apnCache_.end()) {
+        apnCacheMissCount_++;
+        return false;
+    }
+    apnCacheHitCount_++;
+    apnVec.insert(apnVec.end(), it->second.begin(), it->second.end());
+    return true;
+}
+
+void CellularDataRdbHelper::PutCachedApns(
+    const std::string &key, uint64_t version, const std::vector<PdpProfile> &apnVec)
+{
+    std::lock_guard<std::mutex> lock(apnCacheMutex_);
+    // The database changed while the query was in flight, the result may already be stale.
+    if (version != apnCacheVersion_) {
+        TELEPHONY_LOGI("apn cache version changed, drop result");
+        return;
+    }
+    if (apnCache_.size() >= MAX_APN_CACHE_SIZE && apnCache_.find(key) == apnCache_.end()) {
+        apnCache_.clear();
+    }
+    apnCache_[key] = apnVec;
+}
+
+uint64_t CellularDataRdbHelper::GetApnCacheVersion()
+{
+    std::lock_guard<std::mutex> lock(apnCacheMutex_);
+    return apnCacheVersion_;
+}
+
+void CellularDataRdbHelper::InvalidateApnCache()
+{
+    std::lock_guard<std::mutex> lock(apnCacheMutex_);
+    apnCacheVersion_++;
+    apnCache_.clear();
+    TELEPHONY_LOGI("apn cache invalidated, version = %{public}" PRIu64, apnCacheVersion_);
+}
+
+std::string CellularDataRdbHelper::GetApnCacheDump()
+{
+    std::lock_guard<std::mutex> lock(apnCacheMutex_);
+    std::ostringstream oss;
+    oss << "hit:" << apnCacheHitCount_.load() << " miss:" << apnCacheMissCount_.load()
+        << " entries:" << apnCache_.size() << " version:" << apnCacheVersion_;
+    return oss.str();
 }
 } // namespace Telephony
 } // namespace OHOS
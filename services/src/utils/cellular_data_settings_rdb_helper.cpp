@@ -24,11 +24,31 @@ namespace OHOS {
 namespace Telephony {
 static constexpr const int32_t E_ERROR = -1;
 
-CellularDataSettingsRdbHelper::CellularDataSettingsRdbHelper() {}
+CellularDataSettingsRdbHelper::CellularDataSettingsRdbHelper()
+    : helperPool_(std::make_shared<DataShareHelperPool>())
+{}
 
 CellularDataSettingsRdbHelper::~CellularDataSettingsRdbHelper() {}
 
 std::shared_ptr<DataShare::DataShareHelper> CellularDataSettingsRdbHelper::CreateDataShareHelper()
+{
+    sptr<IRemoteObject> watchedRemote = nullptr;
+    return CreateDataShareHelper(watchedRemote);
+}
+
+std::shared_ptr<DataShare::DataShareHelper> CellularDataSettingsRdbHelper::AcquireDataShareHelper()
+{
+    return helperPool_->Acquire(
+        [this](sptr<IRemoteObject> &watchedRemote) { return CreateDataShareHelper(watchedRemote); });
+}
+
+std::string CellularDataSettingsRdbHelper::GetHelperPoolDump()
+{
+    return helperPool_->GetDump();
+}
+
+std::shared_ptr<DataShare::DataShareHelper> CellularDataSettingsRdbHelper::CreateDataShareHelper(
+    sptr<IRemoteObject> &watchedRemote)
 {
     sptr<ISystemAbilityManager> saManager = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (saManager == nullptr) {
@@ -48,6 +68,7 @@ std::shared_ptr<DataShare::DataShareHelper> CellularDataSettingsRdbHelper::Creat
     auto [ret, helper] =
         DataShare::DataShareHelper::Create(remoteObj, CELLULAR_DATA_SETTING_URI, CELLULAR_DATA_SETTING_EXT_URI);
     if (ret == DataShare::E_OK) {
+        watchedRemote = distributedData;
         return helper;
     } else if (ret == DataShare::E_DATA_SHARE_NOT_READY) {
         TELEPHONY_LOGE("CellularDataRdbHelper: datashare not ready.");
@@ -61,43 +82,40 @@ std::shared_ptr<DataShare::DataShareHelper> CellularDataSettingsRdbHelper::Creat
 void CellularDataSettingsRdbHelper::UnRegisterSettingsObserver(
     const Uri &uri, const sptr<AAFwk::IDataAbilityObserver> &dataObserver)
 {
-    std::shared_ptr<DataShare::DataShareHelper> settingHelper = CreateDataShareHelper();
+    std::shared_ptr<DataShare::DataShareHelper> settingHelper = AcquireDataShareHelper();
     if (settingHelper == nullptr) {
         TELEPHONY_LOGE("UnRegister settings observer failed by nullptr");
         return;
     }
     settingHelper->UnregisterObserver(uri, dataObserver);
-    settingHelper->Release();
     TELEPHONY_LOGE("UnRegisterSettingsObserver success");
 }
 
 void CellularDataSettingsRdbHelper::RegisterSettingsObserver(
     const Uri &uri, const sptr<AAFwk::IDataAbilityObserver> &dataObserver)
 {
-    std::shared_ptr<DataShare::DataShareHelper> settingHelper = CreateDataShareHelper();
+    std::shared_ptr<DataShare::DataShareHelper> settingHelper = AcquireDataShareHelper();
     if (settingHelper == nullptr) {
         TELEPHONY_LOGE("Register settings observer by nullptr");
         return;
     }
     settingHelper->RegisterObserver(uri, dataObserver);
-    settingHelper->Release();
     TELEPHONY_LOGE("RegisterSettingsObserver success");
 }
 
 void CellularDataSettingsRdbHelper::NotifyChange(const Uri &uri)
 {
-    std::shared_ptr<DataShare::DataShareHelper> settingHelper = CreateDataShareHelper();
+    std::shared_ptr<DataShare::DataShareHelper> settingHelper = AcquireDataShareHelper();
     if (settingHelper == nullptr) {
         TELEPHONY_LOGE("notify settings changed fail by nullptr");
         return;
     }
     settingHelper->NotifyChange(uri);
-    settingHelper->Release();
 }
 
 int32_t CellularDataSettingsRdbHelper::GetValue(Uri &uri, const std::string &column, int32_t &value)
 {
-    std::shared_ptr<DataShare::DataShareHelper> settingHelper = CreateDataShareHelper();
+    std::shared_ptr<DataShare::DataShareHelper> settingHelper = AcquireDataShareHelper();
     if (settingHelper == nullptr) {
         TELEPHONY_LOGE("helper_ is null");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -108,7 +126,7 @@ int32_t CellularDataSettingsRdbHelper::GetValue(Uri &uri, const std::string &col
     auto result = settingHelper->Query(uri, predicates, columns);
     if (result == nullptr) {
         TELEPHONY_LOGE("setting DB: query error");
-        settingHelper->Release();
+        helperPool_->Invalidate();
         return TELEPHONY_ERR_DATABASE_READ_FAIL;
     }
     result->GoToFirstRow();
@@ -118,7 +136,6 @@ int32_t CellularDataSettingsRdbHelper::GetValue(Uri &uri, const std::string &col
         result->GetString(columnIndex, resultValue);
     }
     result->Close();
-    settingHelper->Release();
     TELEPHONY_LOGD("Query end resultValue is %{public}s", resultValue.c_str());
     if (!CellularDataUtils::ConvertStrToInt(resultValue, value)) {
         TELEPHONY_LOGD("ConvertStrToInt fail");
@@ -129,7 +146,7 @@ int32_t CellularDataSettingsRdbHelper::GetValue(Uri &uri, const std::string &col
 
 int32_t CellularDataSettingsRdbHelper::PutValue(Uri &uri, const std::string &column, int value)
 {
-    std::shared_ptr<DataShare::DataShareHelper> settingHelper = CreateDataShareHelper();
+    std::shared_ptr<DataShare::DataShareHelper> settingHelper = AcquireDataShareHelper();
     if (settingHelper == nullptr) {
         TELEPHONY_LOGE("helper_ is null");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -151,6 +168,7 @@ int32_t CellularDataSettingsRdbHelper::PutValue(Uri &uri, const std::string &col
     }
     TELEPHONY_LOGI("put value return %{public}d", result);
     if (result == E_ERROR) {
+        helperPool_->Invalidate();
         Uri userDataEnableUri(CELLULAR_DATA_SETTING_DATA_ENABLE_URI);
         Uri userDataRoamingUri(CELLULAR_DATA_SETTING_DATA_ROAMING_URI);
         if (uri == userDataEnableUri) {
@@ -164,11 +182,9 @@ int32_t CellularDataSettingsRdbHelper::PutValue(Uri &uri, const std::string &col
         } else {
             TELEPHONY_LOGI("result is %{public}d, do not handle.", result);
         }
-        settingHelper->Release();
         return TELEPHONY_ERR_DATABASE_WRITE_FAIL;
     }
     settingHelper->NotifyChange(uri);
-    settingHelper->Release();
     return TELEPHONY_ERR_SUCCESS;
 }
 } // namespace Telephony
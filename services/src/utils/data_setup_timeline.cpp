@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_setup_timeline.h"
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "apn_manager.h"
+#include "hitrace_meter.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr size_t SETUP_TIMELINE_RING_SIZE = 16;
+constexpr uint32_t SETUP_STAGE_COUNT = static_cast<uint32_t>(SetupStage::STAGE_COUNT);
+constexpr int64_t STAGE_NOT_REACHED = -1;
+const char *const SETUP_STAGE_NAMES[] = { "RequestNet", "MsgRequestNetwork", "MsgEstablishDataConnection",
+    "AttemptChecksPassed", "DoConnect", "PdpContextDone", "ActiveEntered", "NetworkInfoUpdated" };
+
+struct SetupTimeline {
+    int32_t slotId = -1;
+    int32_t apnId = 0;
+    int32_t connectId = -1;
+    SetupStage lastStage = SetupStage::REQUEST_NET;
+    bool completed = false;
+    int64_t stageTimeUs[SETUP_STAGE_COUNT] = {};
+};
+
+std::mutex g_timelineMutex;
+std::map<std::pair<int32_t, int32_t>, SetupTimeline> g_openTimelines;
+std::deque<SetupTimeline> g_finishedTimelines;
+
+int64_t GetSteadyTimeUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string GetStageTraceName(const SetupTimeline &timeline, SetupStage stage)
+{
+    return "DataSetup:Slot" + std::to_string(timeline.slotId) + ":" +
+        ApnManager::FindApnNameByApnId(timeline.apnId) + ":" + SETUP_STAGE_NAMES[static_cast<uint32_t>(stage)];
+}
+
+SetupTimeline CreateTimeline(int32_t slotId, int32_t apnId)
+{
+    SetupTimeline timeline;
+    timeline.slotId = slotId;
+    timeline.apnId = apnId;
+    for (uint32_t i = 0; i < SETUP_STAGE_COUNT; i++) {
+        timeline.stageTimeUs[i] = STAGE_NOT_REACHED;
+    }
+    return timeline;
+}
+
+// the async slices are keyed on the connectId of the attempt, they start once the state machine assigned it
+void StartStageTrace(const SetupTimeline &timeline)
+{
+    if (timeline.connectId >= 0) {
+        StartAsyncTrace(HITRACE_TAG_OHOS, GetStageTraceName(timeline, timeline.lastStage), timeline.connectId);
+    }
+}
+
+void FinishStageTrace(const SetupTimeline &timeline)
+{
+    if (timeline.connectId >= 0) {
+        FinishAsyncTrace(HITRACE_TAG_OHOS, GetStageTraceName(timeline, timeline.lastStage), timeline.connectId);
+    }
+}
+
+void FinishTimeline(SetupTimeline &timeline, bool keep, bool completed)
+{
+    FinishStageTrace(timeline);
+    if (!keep) {
+        return;
+    }
+    timeline.completed = completed;
+    if (g_finishedTimelines.size() >= SETUP_TIMELINE_RING_SIZE) {
+        g_finishedTimelines.pop_front();
+    }
+    g_finishedTimelines.push_back(timeline);
+}
+} // namespace
+
+void DataSetupTimeline::Mark(int32_t slotId, int32_t apnId, SetupStage stage, int32_t connectId)
+{
+    if (stage >= SetupStage::STAGE_COUNT) {
+        return;
+    }
+    int64_t nowUs = GetSteadyTimeUs();
+    bool isRequestStage = stage < SetupStage::DO_CONNECT;
+    std::lock_guard<std::mutex> lock(g_timelineMutex);
+    auto key = std::make_pair(slotId, apnId);
+    auto it = g_openTimelines.find(key);
+    if (it != g_openTimelines.end()) {
+        SetupTimeline &timeline = it->second;
+        bool connecting = timeline.lastStage >= SetupStage::DO_CONNECT;
+        if (isRequestStage && (connecting || stage <= timeline.lastStage)) {
+            // the request is polled again before or while the attempt is in flight, keep the first timestamps
+            return;
+        }
+        if (stage == SetupStage::DO_CONNECT && connecting) {
+            FinishTimeline(timeline, true, false);
+            g_openTimelines.erase(it);
+            it = g_openTimelines.end();
+        }
+    }
+    if (it == g_openTimelines.end()) {
+        if (!isRequestStage && stage != SetupStage::DO_CONNECT) {
+            return;
+        }
+        it = g_openTimelines.emplace(key, CreateTimeline(slotId, apnId)).first;
+    } else {
+        FinishStageTrace(it->second);
+    }
+    SetupTimeline &timeline = it->second;
+    timeline.stageTimeUs[static_cast<uint32_t>(stage)] = nowUs;
+    timeline.lastStage = stage;
+    if (connectId >= 0) {
+        timeline.connectId = connectId;
+    }
+    StartStageTrace(timeline);
+    if (stage == SetupStage::NETWORK_INFO_UPDATED) {
+        FinishTimeline(timeline, true, true);
+        g_openTimelines.erase(it);
+    }
+}
+
+void DataSetupTimeline::Abort(int32_t slotId, int32_t apnId)
+{
+    std::lock_guard<std::mutex> lock(g_timelineMutex);
+    auto it = g_openTimelines.find(std::make_pair(slotId, apnId));
+    if (it == g_openTimelines.end()) {
+        return;
+    }
+    // a request released before DoConnect is not an attempt, it is dropped without a dump entry
+    FinishTimeline(it->second, it->second.lastStage >= SetupStage::DO_CONNECT, false);
+    g_openTimelines.erase(it);
+}
+
+std::string DataSetupTimeline::Dump()
+{
+    std::lock_guard<std::mutex> lock(g_timelineMutex);
+    std::string result;
+    for (const SetupTimeline &timeline : g_finishedTimelines) {
+        int64_t beginUs = STAGE_NOT_REACHED;
+        int64_t endUs = STAGE_NOT_REACHED;
+        std::string stages;
+        for (uint32_t i = 0; i < SETUP_STAGE_COUNT; i++) {
+            if (timeline.stageTimeUs[i] == STAGE_NOT_REACHED) {
+                continue;
+            }
+            if (beginUs == STAGE_NOT_REACHED) {
+                beginUs = timeline.stageTimeUs[i];
+            }
+            endUs = timeline.stageTimeUs[i];
+            stages.append(" ").append(SETUP_STAGE_NAMES[i]).append(":+")
+                .append(std::to_string(timeline.stageTimeUs[i] - beginUs)).append("us");
+        }
+        result.append("Slot").append(std::to_string(timeline.slotId))
+            .append(" apn:").append(ApnManager::FindApnNameByApnId(timeline.apnId))
+            .append(" connectId:").append(std::to_string(timeline.connectId))
+            .append(timeline.completed ? " connected" : " failed")
+            .append(" total:").append(std::to_string(endUs - beginUs)).append("us")
+            .append(stages).append("\n");
+    }
+    return result;
+}
+
+void DataSetupTimeline::Clear()
+{
+    std::lock_guard<std::mutex> lock(g_timelineMutex);
+    for (auto &item : g_openTimelines) {
+        FinishStageTrace(item.second);
+    }
+    g_openTimelines.clear();
+    g_finishedTimelines.clear();
+}
+} // namespace Telephony
+} // namespace OHOS
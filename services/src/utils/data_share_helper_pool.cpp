@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_share_helper_pool.h"
+
+#include <chrono>
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+DataShareHelperPool::DataShareHelperPool(int64_t idleTimeoutMs) : idleTimeoutMs_(idleTimeoutMs) {}
+
+DataShareHelperPool::~DataShareHelperPool()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ResetLocked();
+}
+
+std::shared_ptr<DataShare::DataShareHelper> DataShareHelperPool::Acquire(const HelperCreator &creator)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t now = GetSteadyTimeMs();
+    if (helper_ != nullptr && now - lastUseTimeMs_ > idleTimeoutMs_) {
+        TELEPHONY_LOGI("data share helper idle for %{public}lld ms, recreate",
+            static_cast<long long>(now - lastUseTimeMs_));
+        idleReleaseCount_++;
+        ResetLocked();
+    }
+    if (helper_ != nullptr) {
+        lastUseTimeMs_ = now;
+        reuseCount_++;
+        return helper_;
+    }
+    if (creator == nullptr) {
+        return nullptr;
+    }
+    missCount_++;
+    sptr<IRemoteObject> watchedRemote = nullptr;
+    std::shared_ptr<DataShare::DataShareHelper> helper = creator(watchedRemote);
+    if (helper == nullptr) {
+        return nullptr;
+    }
+    createCount_++;
+    // the last holder releases the underlying connection, no matter whether it is the pool or a caller
+    helper_ = std::shared_ptr<DataShare::DataShareHelper>(
+        helper.get(), [helper](DataShare::DataShareHelper *) { helper->Release(); });
+    WatchRemoteLocked(watchedRemote);
+    lastUseTimeMs_ = now;
+    return helper_;
+}
+
+void DataShareHelperPool::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ResetLocked();
+}
+
+void DataShareHelperPool::WatchRemote(const DataShare::DataShareHelper *helper, const sptr<IRemoteObject> &remote)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (helper == nullptr || helper_.get() != helper) {
+        TELEPHONY_LOGI("data share helper is not pooled any more");
+        return;
+    }
+    WatchRemoteLocked(remote);
+}
+
+void DataShareHelperPool::WatchRemoteLocked(const sptr<IRemoteObject> &remote)
+{
+    if (remote == nullptr || watchedRemote_ != nullptr) {
+        return;
+    }
+    deathRecipient_ = new (std::nothrow) RemoteDeathRecipient(weak_from_this());
+    if (deathRecipient_ != nullptr && remote->AddDeathRecipient(deathRecipient_)) {
+        watchedRemote_ = remote;
+    } else {
+        TELEPHONY_LOGE("add death recipient failed");
+        deathRecipient_ = nullptr;
+    }
+}
+
+uint64_t DataShareHelperPool::GetCreateCount() const
+{
+    return createCount_.load();
+}
+
+uint64_t DataShareHelperPool::GetReuseCount() const
+{
+    return reuseCount_.load();
+}
+
+std::string DataShareHelperPool::GetDump() const
+{
+    return "hit:" + std::to_string(reuseCount_.load()) + " miss:" + std::to_string(missCount_.load()) +
+        " idleRelease:" + std::to_string(idleReleaseCount_.load()) +
+        " remoteDied:" + std::to_string(remoteDiedCount_.load());
+}
+
+void DataShareHelperPool::ResetLocked()
+{
+    if (watchedRemote_ != nullptr && deathRecipient_ != nullptr) {
+        watchedRemote_->RemoveDeathRecipient(deathRecipient_);
+    }
+    watchedRemote_ = nullptr;
+    deathRecipient_ = nullptr;
+    helper_ = nullptr;
+}
+
+int64_t DataShareHelperPool::GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void DataShareHelperPool::RemoteDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
+{
+    TELEPHONY_LOGI("data share remote died");
+    auto pool = pool_.lock();
+    if (pool == nullptr) {
+        return;
+    }
+    pool->remoteDiedCount_++;
+    pool->Invalidate();
+}
+} // namespace Telephony
+} // namespace OHOS
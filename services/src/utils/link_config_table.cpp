@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "link_config_table.h"
+
+#include "cellular_data_utils.h"
+
+namespace OHOS {
+namespace Telephony {
+LinkConfigNrMode LinkConfigTable::GetNrMode(NrState nrState, FrequencyType frequencyType)
+{
+    if (nrState != NrState::NR_NSA_STATE_DUAL_CONNECTED && nrState != NrState::NR_NSA_STATE_CONNECTED_DETECT) {
+        return LinkConfigNrMode::NR_MODE_NONE;
+    }
+    if (frequencyType == FrequencyType::FREQ_TYPE_MMWAVE) {
+        return LinkConfigNrMode::NR_MODE_NSA_MMWAVE;
+    }
+    return LinkConfigNrMode::NR_MODE_NSA;
+}
+
+std::string LinkConfigTable::GetBandwidthConfigName(int32_t radioTech, LinkConfigNrMode nrMode)
+{
+    if (radioTech == static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_LTE)) {
+        if (nrMode == LinkConfigNrMode::NR_MODE_NSA_MMWAVE) {
+            return "NR_NSA_MMWAVE";
+        }
+        if (nrMode == LinkConfigNrMode::NR_MODE_NSA) {
+            return "NR_NSA";
+        }
+    }
+    std::string radioTechName = CellularDataUtils::ConvertRadioTechToRadioName(radioTech);
+    if (radioTechName == "NR") {
+        radioTechName = "NR_SA";
+    }
+    return radioTechName;
+}
+
+std::string LinkConfigTable::GetTcpBufferConfigName(int32_t radioTech, LinkConfigNrMode nrMode)
+{
+    if ((radioTech == static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_LTE) ||
+        radioTech == static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_LTE_CA)) &&
+        nrMode != LinkConfigNrMode::NR_MODE_NONE) {
+        return "NR";
+    }
+    return CellularDataUtils::ConvertRadioTechToRadioName(radioTech);
+}
+
+std::shared_ptr<const LinkConfigTable> LinkConfigTable::Build(
+    const std::map<std::string, LinkBandwidthInfo> &bandwidths, const std::map<std::string, std::string> &tcpBuffers)
+{
+    auto table = std::make_shared<LinkConfigTable>();
+    for (size_t radioTech = 0; radioTech < RADIO_TECH_COUNT; ++radioTech) {
+        for (size_t nrMode = 0; nrMode < NR_MODE_COUNT; ++nrMode) {
+            Entry &entry = table->entries_[radioTech][nrMode];
+            auto bandwidthIter = bandwidths.find(
+                GetBandwidthConfigName(static_cast<int32_t>(radioTech), static_cast<LinkConfigNrMode>(nrMode)));
+            if (bandwidthIter != bandwidths.end()) {
+                entry.hasBandwidth = true;
+                entry.bandwidth = bandwidthIter->second;
+            }
+            auto tcpBufferIter = tcpBuffers.find(
+                GetTcpBufferConfigName(static_cast<int32_t>(radioTech), static_cast<LinkConfigNrMode>(nrMode)));
+            if (tcpBufferIter != tcpBuffers.end()) {
+                entry.hasTcpBuffer = true;
+                entry.tcpBuffer = tcpBufferIter->second;
+            }
+        }
+    }
+    return table;
+}
+
+const LinkConfigTable::Entry *LinkConfigTable::GetEntry(int32_t radioTech, LinkConfigNrMode nrMode) const
+{
+    if (radioTech < 0 || static_cast<size_t>(radioTech) >= RADIO_TECH_COUNT ||
+        static_cast<size_t>(nrMode) >= NR_MODE_COUNT) {
+        return nullptr;
+    }
+    return &entries_[radioTech][static_cast<size_t>(nrMode)];
+}
+
+bool LinkConfigTable::GetBandwidth(
+    int32_t radioTech, LinkConfigNrMode nrMode, LinkBandwidthInfo &linkBandwidthInfo) const
+{
+    const Entry *entry = GetEntry(radioTech, nrMode);
+    if (entry == nullptr || !entry->hasBandwidth) {
+        return false;
+    }
+    linkBandwidthInfo = entry->bandwidth;
+    return true;
+}
+
+bool LinkConfigTable::GetTcpBuffer(int32_t radioTech, LinkConfigNrMode nrMode, std::string &tcpBuffer) const
+{
+    const Entry *entry = GetEntry(radioTech, nrMode);
+    if (entry == nullptr || !entry->hasTcpBuffer) {
+        return false;
+    }
+    tcpBuffer = entry->tcpBuffer;
+    return true;
+}
+} // namespace Telephony
+} // namespace OHOS
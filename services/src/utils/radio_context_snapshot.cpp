@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "radio_context_snapshot.h"
+
+namespace OHOS {
+namespace Telephony {
+bool RadioContextSnapshot::IsPsAttached() const
+{
+    return psRegState == static_cast<int32_t>(RegServiceState::REG_STATE_IN_SERVICE);
+}
+
+bool RadioContextSnapshot::IsSimStateReadyOrLoaded() const
+{
+    return simState == SimState::SIM_STATE_READY || simState == SimState::SIM_STATE_LOADED;
+}
+
+std::shared_ptr<const RadioContextSnapshot> RadioContextSnapshot::Capture(int32_t slotId)
+{
+    auto snapshot = std::make_shared<RadioContextSnapshot>();
+    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
+    coreInner.GetPsRadioTech(slotId, snapshot->psRadioTech);
+    snapshot->psRegState = coreInner.GetPsRegState(slotId);
+    snapshot->psRoaming = coreInner.GetPsRoamingState(slotId) > 0;
+    coreInner.GetSimState(slotId, snapshot->simState);
+    snapshot->nrState = coreInner.GetNrState(slotId);
+    snapshot->frequencyType = coreInner.GetFrequencyType(slotId);
+    return snapshot;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stall_detector.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace Telephony {
+static const int32_t PERCENT = 100;
+
+StallDetector::StallDetector(const StallDetectorConfig &config) : config_(config) {}
+
+void StallDetector::SetConfig(const StallDetectorConfig &config)
+{
+    config_ = config;
+    while (!window_.empty() && static_cast<int32_t>(window_.size()) > std::max(config_.windowSize, 1)) {
+        window_.pop_front();
+    }
+}
+
+const StallDetectorConfig &StallDetector::GetConfig() const
+{
+    return config_;
+}
+
+void StallDetector::AddSample(const TrafficDelta &delta)
+{
+    // counters restart from zero when the interface is recreated, such a round carries no information
+    TrafficDelta sample;
+    sample.txPackets = std::max<int64_t>(delta.txPackets, 0);
+    sample.rxPackets = std::max<int64_t>(delta.rxPackets, 0);
+    if (sample.rxPackets > 0) {
+        silentStreakRounds_ = 0;
+        silentStreakTxPackets_ = 0;
+    } else if (sample.txPackets > 0) {
+        silentStreakRounds_++;
+        silentStreakTxPackets_ += sample.txPackets;
+    }
+    window_.push_back(sample);
+    while (static_cast<int32_t>(window_.size()) > std::max(config_.windowSize, 1)) {
+        window_.pop_front();
+    }
+}
+
+bool StallDetector::IsStalled() const
+{
+    // a single unanswered burst is not a stall
+    if (silentStreakRounds_ < config_.minSilentRounds) {
+        return false;
+    }
+    if (silentStreakTxPackets_ < config_.minTxPackets || silentStreakTxPackets_ == 0) {
+        return false;
+    }
+    return GetConfidence() >= config_.confidencePercent;
+}
+
+int32_t StallDetector::GetConfidence() const
+{
+    int32_t activeRounds = 0;
+    int32_t silentRounds = 0;
+    for (const TrafficDelta &delta : window_) {
+        if (delta.txPackets == 0 && delta.rxPackets == 0) {
+            continue;
+        }
+        activeRounds++;
+        if (delta.rxPackets == 0) {
+            silentRounds++;
+        }
+    }
+    return activeRounds == 0 ? 0 : silentRounds * PERCENT / activeRounds;
+}
+
+void StallDetector::Reset()
+{
+    window_.clear();
+    silentStreakRounds_ = 0;
+    silentStreakTxPackets_ = 0;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -1700,5 +1700,172 @@ HWTEST_F(ApnManagerTest, ApnItem_GetPreferId_001, TestSize.Level0)
     bool ret = apnManager->GetPreferId(slotId, errMsg);
     EXPECT_FALSE(ret);
 }
+
+/**
+ * @tc.number   ApnItemCompactAttribute_001
+ * @tc.name     test compact attribute layout
+ * @tc.desc     Function test
+ */
+HWTEST_F(ApnManagerTest, ApnItemCompactAttribute_001, TestSize.Level0)
+{
+    PdpProfile apnData;
+    apnData.profileId = 1;
+    apnData.apnTypes = "default,supl";
+    apnData.mcc = "460";
+    apnData.mnc = "01";
+    apnData.apn = "3gnet";
+    apnData.pdpProtocol = "IPV4V6";
+    sptr<ApnItem> firstApnItem = ApnItem::MakeApn(apnData);
+    apnData.profileId = 2;
+    sptr<ApnItem> secondApnItem = ApnItem::MakeApn(apnData);
+    ASSERT_NE(firstApnItem, nullptr);
+    ASSERT_NE(secondApnItem, nullptr);
+    EXPECT_EQ(firstApnItem->attr_.numeric_.c_str(), secondApnItem->attr_.numeric_.c_str());
+    EXPECT_STREQ(firstApnItem->attr_.numeric_, "46001");
+    EXPECT_TRUE(firstApnItem->attr_.user_.empty());
+
+    ApnItem::Attribute attr;
+    secondApnItem->attr_.ToAttribute(attr);
+    EXPECT_EQ(attr.profileId_, 2);
+    EXPECT_STREQ(attr.types_, "default,supl");
+    EXPECT_STREQ(attr.apn_, "3gnet");
+    EXPECT_NE(ApnItem::GetMemoryDump().find("items:"), std::string::npos);
+
+    // credentials are owned by the item, only low cardinality attributes go to the intern table
+    size_t internedCount = InternedApnString::GetInternedCount();
+    apnData.mcc = "999";
+    apnData.authUser = "user";
+    apnData.authPwd = "password";
+    sptr<ApnItem> credentialApnItem = ApnItem::MakeApn(apnData);
+    ASSERT_NE(credentialApnItem, nullptr);
+    EXPECT_STREQ(credentialApnItem->attr_.password_, "password");
+    EXPECT_EQ(InternedApnString::GetInternedCount(), internedCount + 1);
+    credentialApnItem = nullptr;
+    EXPECT_EQ(InternedApnString::GetInternedCount(), internedCount);
+
+    apnData.apn = std::string(ApnItem::ALL_APN_ITEM_CHAR_LENGTH, 'a');
+    EXPECT_EQ(ApnItem::MakeApn(apnData), nullptr);
+}
+
+/**
+ * @tc.number   ApnItemTypeMask_001
+ * @tc.name     test apn type mask and per-type index
+ * @tc.desc     Function test
+ */
+HWTEST_F(ApnManagerTest, ApnItemTypeMask_001, TestSize.Level0)
+{
+    sptr<ApnItem> allApnItem = ApnItem::MakeDefaultApn(DATA_CONTEXT_ROLE_ALL);
+    ASSERT_NE(allApnItem, nullptr);
+    EXPECT_TRUE(allApnItem->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::MMS)));
+    EXPECT_FALSE(allApnItem->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::IA)));
+    sptr<ApnItem> defaultApnItem = ApnItem::MakeDefaultApn("Default,supl");
+    ASSERT_NE(defaultApnItem, nullptr);
+    EXPECT_TRUE(defaultApnItem->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::INTERNAL_DEFAULT)));
+    EXPECT_TRUE(defaultApnItem->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::SUPL)));
+    EXPECT_FALSE(defaultApnItem->CanDealWithTypeMask(static_cast<uint64_t>(ApnTypes::MMS)));
+
+    std::vector<PdpProfile> apnVec;
+    PdpProfile apnData;
+    apnData.profileId = 1;
+    apnData.apnTypes = "default,supl";
+    apnData.apn = "3gnet";
+    apnVec.push_back(apnData);
+    apnData.profileId = 2;
+    apnData.apnTypes = "mms";
+    apnData.apn = "3gwap";
+    apnVec.push_back(apnData);
+    apnData.profileId = 3;
+    apnData.apnTypes = "ia";
+    apnData.apn = "ims";
+    apnVec.push_back(apnData);
+    apnManager->preferId_ = -1;
+    EXPECT_EQ(apnManager->MakeSpecificApnItem(apnVec, 0), 3);
+    std::vector<sptr<ApnItem>> matchedApns = apnManager->FilterMatchedApns(DATA_CONTEXT_ROLE_DEFAULT, 0);
+    ASSERT_EQ(matchedApns.size(), 1);
+    EXPECT_EQ(matchedApns[0]->attr_.profileId_, 1);
+    matchedApns = apnManager->FilterMatchedApns(DATA_CONTEXT_ROLE_INTERNAL_DEFAULT, 0);
+    ASSERT_EQ(matchedApns.size(), 1);
+    EXPECT_EQ(matchedApns[0]->attr_.profileId_, 1);
+    matchedApns = apnManager->FilterMatchedApns(DATA_CONTEXT_ROLE_MMS, 0);
+    ASSERT_EQ(matchedApns.size(), 1);
+    EXPECT_EQ(matchedApns[0]->attr_.profileId_, 2);
+    EXPECT_TRUE(apnManager->FilterMatchedApns(DATA_CONTEXT_ROLE_XCAP, 0).empty());
+    sptr<ApnItem> attachApn = apnManager->GetRilAttachApn();
+    ASSERT_NE(attachApn, nullptr);
+    EXPECT_EQ(attachApn->attr_.profileId_, 3);
+}
+
+/**
+ * @tc.number   TryMergeSimilarPdpProfile_001
+ * @tc.name     test merging a synthetic 2000-profile database
+ * @tc.desc     Function test
+ */
+HWTEST_F(ApnManagerTest, TryMergeSimilarPdpProfile_001, TestSize.Level0)
+{
+    const int32_t profileCount = 2000;
+    std::vector<PdpProfile> apnVec;
+    for (int32_t i = 0; i < profileCount; i++) {
+        PdpProfile apnData;
+        apnData.profileId = i;
+        apnData.apn = "apn" + std::to_string(i / 2);
+        apnData.apnTypes = (i % 2 == 0) ? DATA_CONTEXT_ROLE_MMS : DATA_CONTEXT_ROLE_SUPL;
+        apnData.pdpProtocol = PROTOCOL_IPV4V6;
+        apnData.roamPdpProtocol = PROTOCOL_IPV4V6;
+        apnVec.push_back(apnData);
+    }
+    apnVec[1].mvnoType = MvnoType::SPN;
+    apnVec[1].mvnoMatchData = "mvno";
+    apnManager->preferId_ = -1;
+    apnManager->TryMergeSimilarPdpProfile(apnVec);
+    // the mvno profile stays apart, every other pair sharing an apn is merged into its first profile
+    ASSERT_EQ(apnVec.size(), static_cast<size_t>(profileCount / 2 + 1));
+    EXPECT_EQ(apnVec[0].profileId, 0);
+    EXPECT_EQ(apnVec[0].apnTypes, DATA_CONTEXT_ROLE_MMS);
+    EXPECT_EQ(apnVec[1].profileId, 1);
+    EXPECT_EQ(apnVec[1].apnTypes, DATA_CONTEXT_ROLE_SUPL);
+    const std::string mergedTypes = std::string(DATA_CONTEXT_ROLE_MMS) + "," + DATA_CONTEXT_ROLE_SUPL;
+    for (size_t i = 2; i < apnVec.size(); i++) {
+        EXPECT_EQ(apnVec[i].profileId, static_cast<int32_t>(2 * (i - 1)));
+        EXPECT_EQ(apnVec[i].apn, "apn" + std::to_string(i - 1));
+        EXPECT_EQ(apnVec[i].apnTypes, mergedTypes);
+    }
+}
+
+/**
+ * @tc.number   ApnStateAggregate_001
+ * @tc.name     test overall apn state read from the aggregate state word
+ * @tc.desc     Function test
+ */
+HWTEST_F(ApnManagerTest, ApnStateAggregate_001, TestSize.Level0)
+{
+    apnManager->InitApnHolders();
+    uint64_t stateWord = 0;
+    ASSERT_TRUE(apnManager->LoadApnStateWord(stateWord));
+    EXPECT_EQ(ApnStateAggregate::GetStateCount(stateWord, PROFILE_STATE_IDLE), apnManager->apnHolders_.size());
+    EXPECT_EQ(apnManager->GetOverallApnState(), PROFILE_STATE_IDLE);
+    EXPECT_FALSE(apnManager->HasAnyConnectedState());
+    uint32_t epoch = ApnStateAggregate::GetEpoch(stateWord);
+
+    sptr<ApnHolder> defaultHolder = apnManager->GetApnHolder(DATA_CONTEXT_ROLE_DEFAULT);
+    sptr<ApnHolder> mmsHolder = apnManager->GetApnHolder(DATA_CONTEXT_ROLE_MMS);
+    ASSERT_NE(defaultHolder, nullptr);
+    ASSERT_NE(mmsHolder, nullptr);
+    mmsHolder->SetApnState(PROFILE_STATE_RETRYING);
+    EXPECT_EQ(apnManager->GetOverallApnState(), PROFILE_STATE_CONNECTING);
+    EXPECT_EQ(apnManager->GetOverallDefaultApnState(), PROFILE_STATE_IDLE);
+    defaultHolder->SetApnState(PROFILE_STATE_CONNECTED);
+    EXPECT_TRUE(apnManager->HasAnyConnectedState());
+    EXPECT_EQ(apnManager->GetOverallApnState(), PROFILE_STATE_CONNECTED);
+    EXPECT_EQ(apnManager->GetOverallDefaultApnState(), PROFILE_STATE_CONNECTED);
+    ASSERT_TRUE(apnManager->LoadApnStateWord(stateWord));
+    EXPECT_EQ(ApnStateAggregate::GetEpoch(stateWord), epoch + 2);
+
+    defaultHolder->SetApnState(PROFILE_STATE_IDLE);
+    mmsHolder->SetApnState(PROFILE_STATE_IDLE);
+    EXPECT_FALSE(apnManager->HasAnyConnectedState());
+    EXPECT_EQ(apnManager->GetOverallApnState(), PROFILE_STATE_IDLE);
+    ASSERT_TRUE(apnManager->LoadApnStateWord(stateWord));
+    EXPECT_EQ(ApnStateAggregate::GetHolderCount(stateWord), apnManager->apnHolders_.size());
+}
 } // namespace Telephony
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -16,9 +16,13 @@
 #define private public
 #define protected public
 
+#include <algorithm>
 #include <gtest/gtest.h>
 
+#include "apn_manager.h"
 #include "cellular_data_dump_helper.h"
+#include "cellular_data_perf_stats.h"
+#include "data_setup_timeline.h"
 #include "core_service_client.h"
 #include "mock/mock_core_service.h"
 #include "telephony_types.h"
@@ -33,6 +37,25 @@ using ::testing::Return;
 using ::testing::AtLeast;
 using ::testing::SetArgReferee;
 
+namespace {
+uint64_t GetDumpValue(const std::string &line, const std::string &name)
+{
+    size_t pos = line.find(name);
+    if (pos == std::string::npos) {
+        return 0;
+    }
+    return std::stoull(line.substr(pos + name.size()));
+}
+
+// percentiles are reported as the upper bound of the bucket holding the sample
+void ExpectPercentile(uint64_t percentile, uint64_t sample)
+{
+    uint32_t index = CellularDataPerfStats::GetBucketIndex(sample);
+    EXPECT_GE(percentile, CellularDataPerfStats::GetBucketLowerBound(index));
+    EXPECT_LT(percentile, CellularDataPerfStats::GetBucketLowerBound(index + 1));
+}
+} // namespace
+
 class CellularDataDumpHelperTest : public testing::Test {
 public:
     CellularDataDumpHelperTest()
@@ -149,5 +172,96 @@ HWTEST_F(CellularDataDumpHelperTest, CellularDataDumpHelper_04, Function | Mediu
     maxSlotCount_ = 0;
 }
 
+HWTEST_F(CellularDataDumpHelperTest, CellularDataDumpHelper_05, Function | MediumTest | Level1)
+{
+    EXPECT_EQ(CellularDataPerfStats::GetBucketIndex(3), 3u);
+    EXPECT_EQ(CellularDataPerfStats::GetBucketLowerBound(CellularDataPerfStats::GetBucketIndex(1000)), 896u);
+    for (int64_t i = 1; i <= 100; i++) {
+        CellularDataPerfStats::Record(PerfComponent::HANDLER, 1, 12345, i, i * 10);
+    }
+    CellularDataDumpHelper help;
+    std::vector<std::string> args = {"cellular_data", "-perf_dump"};
+    std::string result = "";
+    help.Dump(args, result);
+    ASSERT_TRUE(result.find("Ohos cellular data service") == std::string::npos);
+    EXPECT_NE(result.find("dropped:"), std::string::npos);
+    size_t pos = result.find("Handler slot:1 event:12345 count:100 ");
+    ASSERT_NE(pos, std::string::npos);
+    std::string line = result.substr(pos, result.find('\n', pos) - pos);
+    size_t handlePos = line.find(" handleUs ");
+    ASSERT_NE(handlePos, std::string::npos);
+    std::string queueUs = line.substr(0, handlePos);
+    std::string handleUs = line.substr(handlePos);
+    ExpectPercentile(GetDumpValue(queueUs, " p50:"), 50);
+    ExpectPercentile(GetDumpValue(queueUs, " p99:"), 99);
+    EXPECT_EQ(GetDumpValue(queueUs, " max:"), 100u);
+    ExpectPercentile(GetDumpValue(handleUs, " p50:"), 500);
+    ExpectPercentile(GetDumpValue(handleUs, " p99:"), 990);
+    EXPECT_EQ(GetDumpValue(handleUs, " max:"), 1000u);
+}
+
+HWTEST_F(CellularDataDumpHelperTest, CellularDataDumpHelper_06, Function | MediumTest | Level1)
+{
+    DataSetupTimeline::Clear();
+    int32_t apnId = ApnManager::FindApnIdByApnName(DATA_CONTEXT_ROLE_DEFAULT);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::PDP_CONTEXT_DONE);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::REQUEST_NET);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::MSG_REQUEST_NETWORK);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::MSG_ESTABLISH_DATA_CONNECTION);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::ATTEMPT_CHECKS_PASSED);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::DO_CONNECT, 7);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::MSG_ESTABLISH_DATA_CONNECTION);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::PDP_CONTEXT_DONE);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::ACTIVE_ENTERED);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::NETWORK_INFO_UPDATED);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::NETWORK_INFO_UPDATED);
+    DataSetupTimeline::Mark(1, apnId, SetupStage::DO_CONNECT, 3);
+    DataSetupTimeline::Abort(1, apnId);
+    std::string timeline = DataSetupTimeline::Dump();
+    size_t pos = timeline.find("Slot0 apn:default connectId:7 connected");
+    ASSERT_NE(pos, std::string::npos);
+    std::string line = timeline.substr(pos, timeline.find('\n', pos) - pos);
+    EXPECT_NE(line.find("RequestNet:+0us"), std::string::npos);
+    EXPECT_NE(line.find("DoConnect:+"), std::string::npos);
+    EXPECT_NE(line.find("NetworkInfoUpdated:+"), std::string::npos);
+    EXPECT_NE(timeline.find("Slot1 apn:default connectId:3 failed"), std::string::npos);
+    EXPECT_EQ(std::count(timeline.begin(), timeline.end(), '\n'), 2);
+
+    CellularDataDumpHelper help;
+    std::vector<std::string> args = {"cellular_data", "-perf_dump"};
+    std::string result = "";
+    help.Dump(args, result);
+    EXPECT_NE(result.find("Slot0 apn:default connectId:7 connected"), std::string::npos);
+    DataSetupTimeline::Clear();
+}
+
+HWTEST_F(CellularDataDumpHelperTest, CellularDataDumpHelper_07, Function | MediumTest | Level1)
+{
+    DataSetupTimeline::Clear();
+    int32_t apnId = ApnManager::FindApnIdByApnName(DATA_CONTEXT_ROLE_DEFAULT);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::REQUEST_NET);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::MSG_REQUEST_NETWORK);
+    DataSetupTimeline::Abort(0, apnId);
+    EXPECT_TRUE(DataSetupTimeline::Dump().empty());
+
+    DataSetupTimeline::Mark(0, apnId, SetupStage::REQUEST_NET);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::MSG_REQUEST_NETWORK);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::MSG_ESTABLISH_DATA_CONNECTION);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::REQUEST_NET);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::MSG_REQUEST_NETWORK);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::ATTEMPT_CHECKS_PASSED);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::DO_CONNECT, 5);
+    DataSetupTimeline::Mark(0, apnId, SetupStage::NETWORK_INFO_UPDATED);
+    std::string timeline = DataSetupTimeline::Dump();
+    EXPECT_EQ(std::count(timeline.begin(), timeline.end(), '\n'), 1);
+    size_t pos = timeline.find("Slot0 apn:default connectId:5 connected");
+    ASSERT_NE(pos, std::string::npos);
+    std::string line = timeline.substr(pos, timeline.find('\n', pos) - pos);
+    EXPECT_NE(line.find("RequestNet:+0us"), std::string::npos);
+    EXPECT_NE(line.find("MsgEstablishDataConnection:+"), std::string::npos);
+    EXPECT_NE(line.find("AttemptChecksPassed:+"), std::string::npos);
+    DataSetupTimeline::Clear();
+}
+
 }  // namespace Telephony
 }  // namespace OHOS
\ No newline at end of file
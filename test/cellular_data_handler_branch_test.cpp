@@ -102,6 +102,7 @@ HWTEST_F(CellularDataHandlerBranchTest, CheckRoamingState_001, Function | Medium
     // roamingState true, dataRoamingEnabled true, isMmsApn true, isEmergencyApn false, IsRestrictedMode false
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRoamingState(_)).WillOnce(Return(1));
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRadioTech(_, _)).WillOnce(Return(0));
+    cellularDataHandler_->RefreshRadioContext();
     sptr<ApnHolder> apnHolder = new ApnHolder("mms", 0);
     ASSERT_FALSE(cellularDataHandler_ == nullptr);
     ASSERT_FALSE(cellularDataHandler_->dataSwitchSettings_ == nullptr);
@@ -111,12 +112,15 @@ HWTEST_F(CellularDataHandlerBranchTest, CheckRoamingState_001, Function | Medium
     // roamingState false, dataRoamingEnabled true, isMmsApn false, isEmergencyApn true, IsRestrictedMode false
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRoamingState(_)).WillOnce(Return(0));
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRadioTech(_, _)).WillOnce(Return(0));
+    cellularDataHandler_->RefreshRadioContext();
     apnHolder = new ApnHolder("emergency", 0);
     cellularDataHandler_->dataSwitchSettings_->UpdateUserDataRoamingOn(true);
     ASSERT_TRUE(cellularDataHandler_->CheckRoamingState(apnHolder));
 
     // roamingState true, dataRoamingEnabled false, isMmsApn true, isEmergencyApn false, IsRestrictedMode false
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRoamingState(_)).WillOnce(Return(1));
+    EXPECT_CALL(*mockNetworkSearchManager, GetPsRadioTech(_, _)).WillOnce(Return(0));
+    cellularDataHandler_->RefreshRadioContext();
     apnHolder = new ApnHolder("mms", 0);
     cellularDataHandler_->dataSwitchSettings_->UpdateUserDataRoamingOn(false);
     ASSERT_FALSE(cellularDataHandler_->CheckRoamingState(apnHolder));
@@ -125,6 +129,7 @@ HWTEST_F(CellularDataHandlerBranchTest, CheckRoamingState_001, Function | Medium
     int32_t tech = 1;
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRoamingState(_)).WillOnce(Return(0));
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRadioTech(_, _)).WillOnce(DoAll(SetArgReferee<1>(tech), Return(0)));
+    cellularDataHandler_->RefreshRadioContext();
     cellularDataHandler_->lastCallState_ = 1;
     apnHolder = new ApnHolder("emergency", 0);
     cellularDataHandler_->dataSwitchSettings_->UpdateUserDataRoamingOn(false);
@@ -323,9 +328,11 @@ HWTEST_F(CellularDataHandlerBranchTest, HandleSimStateChanged, Function | Medium
     ASSERT_EQ(cellularDataHandler_->lastIccId_, iccId);
 
     cellularDataHandler_->isRilApnAttached_ = true;
+    cellularDataHandler_->pendingIntents_.AddEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID, 0);
     simState = SimState::SIM_STATE_NOT_PRESENT;
     EXPECT_CALL(*mockSimManager, GetSimState(_, _)).WillOnce(DoAll(SetArgReferee<1>(simState), Return(0)));
     cellularDataHandler_->HandleSimStateChanged();
+    EXPECT_TRUE(cellularDataHandler_->pendingIntents_.establishDueTimes_.empty());
 
     simState = SimState::SIM_STATE_NOT_READY;
     EXPECT_CALL(*mockSimManager, GetSimState(_, _)).WillOnce(DoAll(SetArgReferee<1>(simState), Return(0)));
@@ -611,6 +618,7 @@ HWTEST_F(CellularDataHandlerBranchTest, CheckAttachAndSimState_001, Function | M
     SimState simState = SimState::SIM_STATE_READY;
     EXPECT_CALL(*mockSimManager, GetSimState(_, _)).WillRepeatedly(DoAll(SetArgReferee<1>(simState), Return(0)));
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRegState(_)).WillOnce(Return(0));
+    cellularDataHandler_->RefreshRadioContext();
     EXPECT_FALSE(cellularDataHandler_->CheckAttachAndSimState(apnHolder));
 
     cellularDataHandler_->isMccChanged_ = true;
@@ -619,8 +627,31 @@ HWTEST_F(CellularDataHandlerBranchTest, CheckAttachAndSimState_001, Function | M
     cellularDataHandler_->isMccChanged_ = false;
     cellularDataHandler_->RemoveAllEvents();
     EXPECT_CALL(*mockNetworkSearchManager, GetPsRegState(_)).WillOnce(Return(1));
+    cellularDataHandler_->RefreshRadioContext();
     cellularDataHandler_->CheckAttachAndSimState(apnHolder);
     EXPECT_FALSE(cellularDataHandler_->HasInnerEvent(CellularDataEventCode::MSG_RESUME_DATA_PERMITTED_TIMEOUT));
 }
+
+HWTEST_F(CellularDataHandlerBranchTest, RadioContextSnapshot_001, Function | MediumTest | Level3)
+{
+    InitCellularDataHandler();
+    InitMockManager();
+    int32_t tech = static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_LTE);
+    EXPECT_CALL(*mockNetworkSearchManager, GetPsRadioTech(_, _)).WillOnce(DoAll(SetArgReferee<1>(tech), Return(0)));
+    EXPECT_CALL(*mockNetworkSearchManager, GetPsRoamingState(_)).WillOnce(Return(1));
+    EXPECT_CALL(*mockNetworkSearchManager, GetPsRegState(_)).WillOnce(Return(0));
+    EXPECT_TRUE(cellularDataHandler_->IsRadioContextEvent(RadioEvent::RADIO_PS_ROAMING_OPEN));
+    EXPECT_FALSE(cellularDataHandler_->IsRadioContextEvent(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION));
+    cellularDataHandler_->RefreshRadioContext();
+    auto radioContext = cellularDataHandler_->GetRadioContext();
+    ASSERT_NE(radioContext, nullptr);
+    EXPECT_EQ(radioContext->psRadioTech, tech);
+    EXPECT_TRUE(radioContext->psRoaming);
+    EXPECT_EQ(radioContext->psRegState, 0);
+    // decisions taken before the next radio event read the same snapshot
+    EXPECT_EQ(cellularDataHandler_->GetRadioContext(), radioContext);
+    EXPECT_FALSE(cellularDataHandler_->IsRestrictedMode());
+    UnmockManager();
+}
 }  // namespace Telephony
 }  // namespace OHOS
\ No newline at end of file
@@ -15,11 +15,15 @@
 #define private public
 #define protected public
 
+#include <chrono>
+
 #include "gtest/gtest.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
 #include "cellular_data_handler.h"
 #include "cellular_data_controller.h"
+#include "cellular_data_perf_stats.h"
+#include "event_dispatch_table.h"
 #ifdef BASE_POWER_IMPROVEMENT
 #include "cellular_data_power_save_mode_subscriber.h"
 #endif
@@ -949,10 +953,15 @@ HWTEST_F(CellularDataHandlerTest, CheckApnActivate001, Function | MediumTest | L
     resultInfo4->flag = DATA_CONTEXT_ROLE_DEFAULT_ID;
     resultInfo4->reason = 2;
     cellularDataHandler->SetApnActivateEnd(resultInfo4);
-    cellularDataHandler->GetApnActReportInfo(DATA_CONTEXT_ROLE_DEFAULT_ID);
-    cellularDataHandler->GetApnActReportInfo(DATA_CONTEXT_ROLE_INTERNAL_DEFAULT_ID);
-    int32_t listLen = 4;
-    EXPECT_EQ(cellularDataHandler->apnActivateChrList_.size(), listLen);
+    ApnActivateReportInfo defaultInfo = cellularDataHandler->GetApnActReportInfo(DATA_CONTEXT_ROLE_DEFAULT_ID);
+    ApnActivateReportInfo internalInfo =
+        cellularDataHandler->GetApnActReportInfo(DATA_CONTEXT_ROLE_INTERNAL_DEFAULT_ID);
+    EXPECT_EQ(defaultInfo.actTimes, 2u);
+    EXPECT_EQ(defaultInfo.actSuccTimes, 0u);
+    EXPECT_EQ(defaultInfo.topReason, 2u);
+    EXPECT_EQ(internalInfo.actTimes, 2u);
+    EXPECT_EQ(internalInfo.actSuccTimes, 1u);
+    EXPECT_EQ(internalInfo.topReason, 1u);
 }
 
 /**
@@ -965,14 +974,39 @@ HWTEST_F(CellularDataHandlerTest, CheckApnActivate002, Function | MediumTest | L
     int32_t slotId = 0;
     auto cellularDataHandler = std::make_shared<CellularDataHandler>(slotId);
     cellularDataHandler->Init();
-    ApnActivateInfo info1;
-    info1.reason = 0;
-    info1.actSuccTime = 0;
-    info1.apnId = 1;
-    info1.duration = 0;
-    cellularDataHandler->apnActivateChrList_.push_back(info1);
-    cellularDataHandler->EraseApnActivateList();
-    EXPECT_EQ(cellularDataHandler->apnActivateChrList_.size(), 0);
+    ApnActivateStats &stats = cellularDataHandler->defaultApnActStats_;
+    int64_t startTime = cellularDataHandler->GetCurTime() - KEEP_APN_ACTIVATE_PERIOD * 4;
+    uint32_t reasons[] = { 0, 1, 1, 2 };
+    for (int64_t i = 0; i < KEEP_APN_ACTIVATE_PERIOD; i++) {
+        uint32_t reason = reasons[i % 4];
+        stats.Add(startTime + i, reason == 0 ? 40 : 0, reason);
+    }
+    ApnActivateReportInfo info = stats.GetReportInfo(startTime + KEEP_APN_ACTIVATE_PERIOD);
+    EXPECT_GT(info.actTimes, 0u);
+    EXPECT_LE(info.actTimes, KEEP_APN_ACTIVATE_PERIOD);
+    EXPECT_EQ(info.topReason, 1u);
+    EXPECT_EQ(info.averDuration, 40u);
+    info = cellularDataHandler->GetApnActReportInfo(DATA_CONTEXT_ROLE_DEFAULT_ID);
+    EXPECT_EQ(info.actTimes, 0u);
+    EXPECT_EQ(info.actSuccTimes, 0u);
+}
+
+/**
+@tc.number Telephony_CheckApnActivate003
+@tc.name CheckApnActivate003
+@tc.desc Function test, a reason taking over a full bucket does not inherit the count it replaces
+*/
+HWTEST_F(CellularDataHandlerTest, CheckApnActivate003, Function | MediumTest | Level1)
+{
+    ApnActivateStats stats(KEEP_APN_ACTIVATE_PERIOD);
+    int64_t nowMs = KEEP_APN_ACTIVATE_PERIOD;
+    uint32_t reasons[] = { 3, 4, 5, 6, 6, 5, 4, 3, 7 };
+    for (uint32_t reason : reasons) {
+        stats.Add(nowMs, 0, reason);
+    }
+    ApnActivateReportInfo info = stats.GetReportInfo(nowMs);
+    EXPECT_EQ(info.actTimes, 9u);
+    EXPECT_EQ(info.topReason, 4u);
 }
 
 /**
@@ -1350,5 +1384,384 @@ HWTEST_F(CellularDataHandlerTest, IsBlockSetRilAttachApn_001, Function | MediumT
     EXPECT_FALSE(cellularDataHandler->IsBlockSetRilAttachApn());
 }
 
+/**
+ * @tc.number   ClearChangedConnectionsOnUpdateApns_001
+ * @tc.name     test only connections with changed apn are cleared
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularDataHandlerTest, ClearChangedConnectionsOnUpdateApns_001, Function | MediumTest | Level3)
+{
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    ASSERT_NE(cellularDataHandler->apnManager_, nullptr);
+    sptr<ApnItem> defaultApn = ApnItem::MakeDefaultApn(DATA_CONTEXT_ROLE_DEFAULT);
+    sptr<ApnItem> mmsApn = ApnItem::MakeDefaultApn(DATA_CONTEXT_ROLE_MMS);
+    ASSERT_NE(defaultApn, nullptr);
+    ASSERT_NE(mmsApn, nullptr);
+    mmsApn->attr_.profileId_ = 1;
+    cellularDataHandler->apnManager_->allApnItem_ = { defaultApn, mmsApn };
+
+    sptr<ApnItem> usedDefaultApn = ApnItem::MakeDefaultApn(DATA_CONTEXT_ROLE_DEFAULT);
+    sptr<ApnItem> usedMmsApn = ApnItem::MakeDefaultApn(DATA_CONTEXT_ROLE_MMS);
+    usedMmsApn->attr_.profileId_ = 1;
+    usedMmsApn->attr_.apn_ = "edited";
+    std::shared_ptr<DataConnectionManager> connectionManager = nullptr;
+    sptr<ApnHolder> defaultHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_DEFAULT);
+    sptr<ApnHolder> mmsHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_MMS);
+    ASSERT_NE(defaultHolder, nullptr);
+    ASSERT_NE(mmsHolder, nullptr);
+    defaultHolder->SetCurrentApn(usedDefaultApn);
+    defaultHolder->SetApnState(PROFILE_STATE_CONNECTED);
+    defaultHolder->SetCellularDataStateMachine(std::make_shared<CellularDataStateMachine>(connectionManager, nullptr));
+    mmsHolder->SetCurrentApn(usedMmsApn);
+    mmsHolder->SetApnState(PROFILE_STATE_CONNECTED);
+    mmsHolder->SetCellularDataStateMachine(std::make_shared<CellularDataStateMachine>(connectionManager, nullptr));
+    cellularDataHandler->lastApnItem_ = new ApnItem();
+    *cellularDataHandler->lastApnItem_ = *defaultApn;
+
+    cellularDataHandler->ClearChangedConnectionsOnUpdateApns(DisConnectionReason::REASON_CLEAR_CONNECTION);
+    EXPECT_EQ(defaultHolder->GetApnState(), PROFILE_STATE_CONNECTED);
+    EXPECT_EQ(mmsHolder->GetApnState(), PROFILE_STATE_DISCONNECTING);
+}
+
+/**
+ * @tc.number   ClearChangedConnectionsOnUpdateApns_002
+ * @tc.name     test switching the preferred apn tears down and rebuilds the default connection
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularDataHandlerTest, ClearChangedConnectionsOnUpdateApns_002, Function | MediumTest | Level3)
+{
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    ASSERT_NE(cellularDataHandler->apnManager_, nullptr);
+    sptr<ApnItem> oldApn = ApnItem::MakeDefaultApn(DATA_CONTEXT_ROLE_DEFAULT);
+    ASSERT_NE(oldApn, nullptr);
+    cellularDataHandler->lastApnItem_ = new ApnItem();
+    *cellularDataHandler->lastApnItem_ = *oldApn;
+
+    sptr<ApnItem> preferredApn = ApnItem::MakeDefaultApn(DATA_CONTEXT_ROLE_DEFAULT);
+    ASSERT_NE(preferredApn, nullptr);
+    preferredApn->attr_.profileId_ = 2;
+    cellularDataHandler->apnManager_->allApnItem_ = { preferredApn, oldApn };
+    cellularDataHandler->apnManager_->preferId_ = preferredApn->attr_.profileId_;
+    std::shared_ptr<DataConnectionManager> connectionManager = nullptr;
+    sptr<ApnHolder> defaultHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_DEFAULT);
+    ASSERT_NE(defaultHolder, nullptr);
+    // the old apn is still in the set, the per holder diff alone would keep the connection on it
+    defaultHolder->SetCurrentApn(oldApn);
+    defaultHolder->SetApnState(PROFILE_STATE_CONNECTED);
+    defaultHolder->SetCellularDataStateMachine(std::make_shared<CellularDataStateMachine>(connectionManager, nullptr));
+
+    cellularDataHandler->ClearChangedConnectionsOnUpdateApns(DisConnectionReason::REASON_CLEAR_CONNECTION);
+    EXPECT_EQ(defaultHolder->GetApnState(), PROFILE_STATE_DISCONNECTING);
+    ASSERT_NE(cellularDataHandler->lastApnItem_, nullptr);
+    EXPECT_EQ(cellularDataHandler->lastApnItem_->attr_.profileId_, preferredApn->attr_.profileId_);
+
+    // once rebuilt on the preferred apn, the next apn change keeps the connection
+    defaultHolder->SetCurrentApn(preferredApn);
+    defaultHolder->SetApnState(PROFILE_STATE_CONNECTED);
+    defaultHolder->SetCellularDataStateMachine(std::make_shared<CellularDataStateMachine>(connectionManager, nullptr));
+    cellularDataHandler->ClearChangedConnectionsOnUpdateApns(DisConnectionReason::REASON_CLEAR_CONNECTION);
+    EXPECT_EQ(defaultHolder->GetApnState(), PROFILE_STATE_CONNECTED);
+}
+
+/**
+@tc.number Telephony_PendingIntentTable_001
+@tc.name PendingIntentTable_001
+@tc.desc Function test
+*/
+HWTEST_F(CellularDataHandlerTest, PendingIntentTable_001, Function | MediumTest | Level1)
+{
+    PendingIntentTable table;
+    EXPECT_TRUE(table.AddNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_REQUEST_NET, 0));
+    EXPECT_FALSE(table.AddNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_REQUEST_NET, 0));
+    EXPECT_TRUE(table.AddNetRequest(DATA_CONTEXT_ROLE_MMS_ID, "simId1", TYPE_REQUEST_NET, 0));
+    EXPECT_TRUE(table.AddNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_RELEASE_NET, 0));
+    EXPECT_FALSE(table.AddNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_RELEASE_NET, 0));
+    EXPECT_TRUE(table.AddNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_REQUEST_NET, 0));
+    table.FinishNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_REQUEST_NET);
+    table.FinishNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_RELEASE_NET);
+    EXPECT_FALSE(table.AddNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_REQUEST_NET, 0));
+    table.FinishNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_REQUEST_NET);
+    EXPECT_TRUE(table.AddNetRequest(DATA_CONTEXT_ROLE_DEFAULT_ID, "simId1", TYPE_REQUEST_NET, 0));
+
+    EXPECT_TRUE(table.AddEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID, ESTABLISH_DATA_CONNECTION_DELAY));
+    EXPECT_TRUE(table.AddEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID, 0));
+    EXPECT_FALSE(table.AddEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID, ESTABLISH_DATA_CONNECTION_DELAY));
+    EXPECT_TRUE(table.AddEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID, 0, true));
+    table.FinishEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID);
+    table.FinishEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID);
+    table.FinishEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID);
+    EXPECT_TRUE(table.AddEstablish(DATA_CONTEXT_ROLE_DEFAULT_ID, 0));
+    EXPECT_EQ(table.GetCoalescedCount(), 4u);
+
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    sptr<ApnHolder> apnHolder = cellularDataHandler->apnManager_->FindApnHolderById(DATA_CONTEXT_ROLE_DEFAULT_ID);
+    ASSERT_NE(apnHolder, nullptr);
+    apnHolder->SetApnState(PROFILE_STATE_CONNECTING);
+    apnHolder->dataCallEnabled_ = true;
+    auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_ESTABLISH_DATA_CONNECTION,
+        DATA_CONTEXT_ROLE_DEFAULT_ID);
+    cellularDataHandler->MsgEstablishDataConnection(event);
+    EXPECT_EQ(apnHolder->GetApnState(), PROFILE_STATE_CONNECTING);
+    EXPECT_NE(cellularDataHandler->GetPendingIntentDump().find("coalesced: "), std::string::npos);
+}
+
+/**
+@tc.number Telephony_WarmUpConnectionPool_001
+@tc.name WarmUpConnectionPool_001
+@tc.desc Function test, the pool is filled by Init before any sim event is handled
+*/
+HWTEST_F(CellularDataHandlerTest, WarmUpConnectionPool_001, Function | MediumTest | Level1)
+{
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    sleep(1);
+    EXPECT_EQ(cellularDataHandler->connectionPool_.size(), CONNECTION_POOL_SIZE);
+    auto stateMachine = cellularDataHandler->AcquireCellularDataConnect();
+    ASSERT_NE(stateMachine, nullptr);
+    EXPECT_NE(stateMachine->inActiveState_, nullptr);
+    EXPECT_EQ(cellularDataHandler->connectionPool_.size(), CONNECTION_POOL_SIZE - 1);
+    cellularDataHandler->connectionManager_->AddConnectionStateMachine(stateMachine);
+    cellularDataHandler->WarmUpConnectionPool();
+    EXPECT_EQ(cellularDataHandler->connectionPool_.size(), CONNECTION_POOL_SIZE - 1);
+}
+
+/**
+@tc.number Telephony_DrainConnectionPool_001
+@tc.name DrainConnectionPool_001
+@tc.desc Function test
+*/
+HWTEST_F(CellularDataHandlerTest, DrainConnectionPool_001, Function | MediumTest | Level1)
+{
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_WARM_UP_CONNECTION_POOL);
+    cellularDataHandler->HandleWarmUpConnectionPool(event);
+    ASSERT_EQ(cellularDataHandler->connectionPool_.size(), CONNECTION_POOL_SIZE);
+    std::weak_ptr<CellularDataStateMachine> pooled = cellularDataHandler->connectionPool_.front();
+    long handlerUseCount = cellularDataHandler.use_count();
+    EXPECT_GT(handlerUseCount, 1);
+    cellularDataHandler->DrainConnectionPool();
+    EXPECT_TRUE(cellularDataHandler->connectionPool_.empty());
+    EXPECT_TRUE(pooled.expired());
+    EXPECT_LT(cellularDataHandler.use_count(), handlerUseCount);
+    EXPECT_FALSE(cellularDataHandler->HasInnerEvent(CellularDataEventCode::MSG_WARM_UP_CONNECTION_POOL));
+}
+
+/**
+@tc.number Telephony_HandleSortConnection_001
+@tc.name HandleSortConnection_001
+@tc.desc Function test, only holders that are not blocked are queued across the priority queue
+*/
+HWTEST_F(CellularDataHandlerTest, HandleSortConnection_001, Function | MediumTest | Level1)
+{
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    ASSERT_NE(cellularDataHandler->apnManager_, nullptr);
+    sptr<ApnHolder> defaultHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_DEFAULT);
+    sptr<ApnHolder> mmsHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_MMS);
+    sptr<ApnHolder> suplHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_SUPL);
+    ASSERT_NE(defaultHolder, nullptr);
+    ASSERT_NE(mmsHolder, nullptr);
+    ASSERT_NE(suplHolder, nullptr);
+    defaultHolder->dataCallEnabled_ = true;
+    defaultHolder->SetApnState(PROFILE_STATE_IDLE);
+    mmsHolder->dataCallEnabled_ = true;
+    mmsHolder->SetApnState(PROFILE_STATE_FAILED);
+    suplHolder->dataCallEnabled_ = true;
+    suplHolder->SetApnState(PROFILE_STATE_IDLE);
+    cellularDataHandler->waitingApnIds_.insert(DATA_CONTEXT_ROLE_SUPL_ID);
+    cellularDataHandler->pendingIntents_.Clear();
+
+    cellularDataHandler->HandleSortConnection();
+    auto &dueTimes = cellularDataHandler->pendingIntents_.establishDueTimes_;
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_DEFAULT_ID), 1u);
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_MMS_ID), 1u);
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_SUPL_ID), 0u);
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_XCAP_ID), 0u);
+    cellularDataHandler->RemoveAllEvents();
+}
+
+/**
+@tc.number Telephony_EstablishWaitingConnections_001
+@tc.name EstablishWaitingConnections_001
+@tc.desc Function test, a completed activation serves the holders waiting on it and skips retrying ones
+*/
+HWTEST_F(CellularDataHandlerTest, EstablishWaitingConnections_001, Function | MediumTest | Level1)
+{
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    ASSERT_NE(cellularDataHandler->apnManager_, nullptr);
+    sptr<ApnHolder> defaultHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_DEFAULT);
+    sptr<ApnHolder> mmsHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_MMS);
+    sptr<ApnHolder> suplHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_SUPL);
+    ASSERT_NE(defaultHolder, nullptr);
+    ASSERT_NE(mmsHolder, nullptr);
+    ASSERT_NE(suplHolder, nullptr);
+    std::shared_ptr<DataConnectionManager> connectionManager = nullptr;
+    auto stateMachine = std::make_shared<CellularDataStateMachine>(connectionManager, nullptr);
+    stateMachine->apnItem_ = ApnItem::MakeDefaultApn(DATA_CONTEXT_ROLE_DEFAULT);
+    ASSERT_NE(stateMachine->apnItem_, nullptr);
+    stateMachine->apnItem_->apnTypes_ = { DATA_CONTEXT_ROLE_DEFAULT, DATA_CONTEXT_ROLE_MMS, DATA_CONTEXT_ROLE_SUPL };
+    defaultHolder->dataCallEnabled_ = true;
+    defaultHolder->SetApnState(PROFILE_STATE_CONNECTED);
+    defaultHolder->SetCellularDataStateMachine(stateMachine);
+    mmsHolder->dataCallEnabled_ = true;
+    mmsHolder->SetApnState(PROFILE_STATE_IDLE);
+    suplHolder->dataCallEnabled_ = true;
+    suplHolder->SetApnState(PROFILE_STATE_RETRYING);
+    sptr<ApnHolder> xcapHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_XCAP);
+    ASSERT_NE(xcapHolder, nullptr);
+    xcapHolder->dataCallEnabled_ = true;
+    xcapHolder->SetApnState(PROFILE_STATE_IDLE);
+    cellularDataHandler->waitingApnIds_ = { DATA_CONTEXT_ROLE_MMS_ID, DATA_CONTEXT_ROLE_XCAP_ID };
+    cellularDataHandler->pendingIntents_.Clear();
+
+    cellularDataHandler->EstablishWaitingConnections(defaultHolder);
+    auto &dueTimes = cellularDataHandler->pendingIntents_.establishDueTimes_;
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_MMS_ID), 1u);
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_SUPL_ID), 0u);
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_XCAP_ID), 0u);
+    // xcap waits on another activation and keeps its place until that one completes or fails
+    EXPECT_EQ(cellularDataHandler->waitingApnIds_, std::set<int32_t>({ DATA_CONTEXT_ROLE_XCAP_ID }));
+
+    cellularDataHandler->ClearAllConnections(DisConnectionReason::REASON_CLEAR_CONNECTION);
+    EXPECT_TRUE(cellularDataHandler->waitingApnIds_.empty());
+    cellularDataHandler->RemoveAllEvents();
+}
+
+/**
+@tc.number Telephony_EstablishBlockedConnections_001
+@tc.name EstablishBlockedConnections_001
+@tc.desc Function test, holders waiting on a failed activation are queued once
+*/
+HWTEST_F(CellularDataHandlerTest, EstablishBlockedConnections_001, Function | MediumTest | Level1)
+{
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    ASSERT_NE(cellularDataHandler->apnManager_, nullptr);
+    sptr<ApnHolder> mmsHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_MMS);
+    sptr<ApnHolder> suplHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_SUPL);
+    ASSERT_NE(mmsHolder, nullptr);
+    ASSERT_NE(suplHolder, nullptr);
+    std::shared_ptr<DataConnectionManager> connectionManager = nullptr;
+    auto stateMachine = std::make_shared<CellularDataStateMachine>(connectionManager, nullptr);
+    mmsHolder->dataCallEnabled_ = true;
+    mmsHolder->SetApnState(PROFILE_STATE_IDLE);
+    suplHolder->dataCallEnabled_ = true;
+    suplHolder->SetApnState(PROFILE_STATE_RETRYING);
+    cellularDataHandler->pendingIntents_.Clear();
+
+    EXPECT_FALSE(cellularDataHandler->HandleCompatibleDataConnection(stateMachine, mmsHolder));
+    EXPECT_EQ(cellularDataHandler->waitingApnIds_.count(DATA_CONTEXT_ROLE_MMS_ID), 1u);
+    auto &dueTimes = cellularDataHandler->pendingIntents_.establishDueTimes_;
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_MMS_ID), 0u);
+
+    cellularDataHandler->waitingApnIds_.insert(DATA_CONTEXT_ROLE_SUPL_ID);
+    cellularDataHandler->EstablishBlockedConnections();
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_MMS_ID), 1u);
+    EXPECT_EQ(dueTimes.count(DATA_CONTEXT_ROLE_SUPL_ID), 0u);
+    EXPECT_TRUE(cellularDataHandler->waitingApnIds_.empty());
+    cellularDataHandler->RemoveAllEvents();
+}
+
+/**
+@tc.number Telephony_RecordPdnBringUpIfDone_001
+@tc.name RecordPdnBringUpIfDone_001
+@tc.desc Function test, bring-up time is recorded once every enabled apn is connected
+*/
+HWTEST_F(CellularDataHandlerTest, RecordPdnBringUpIfDone_001, Function | MediumTest | Level1)
+{
+    auto cellularDataHandler = std::make_shared<CellularDataHandler>(0);
+    cellularDataHandler->Init();
+    ASSERT_NE(cellularDataHandler->apnManager_, nullptr);
+    sptr<ApnHolder> defaultHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_DEFAULT);
+    sptr<ApnHolder> mmsHolder = cellularDataHandler->apnManager_->GetApnHolder(DATA_CONTEXT_ROLE_MMS);
+    ASSERT_NE(defaultHolder, nullptr);
+    ASSERT_NE(mmsHolder, nullptr);
+    defaultHolder->dataCallEnabled_ = true;
+    defaultHolder->SetApnState(PROFILE_STATE_CONNECTED);
+    mmsHolder->dataCallEnabled_ = true;
+    mmsHolder->SetApnState(PROFILE_STATE_CONNECTING);
+    cellularDataHandler->pdnBringUpPending_ = true;
+    cellularDataHandler->pdnBringUpBeginTime_ = std::chrono::steady_clock::now();
+
+    cellularDataHandler->RecordPdnBringUpIfDone();
+    EXPECT_TRUE(cellularDataHandler->pdnBringUpPending_);
+    mmsHolder->SetApnState(PROFILE_STATE_CONNECTED);
+    cellularDataHandler->RecordPdnBringUpIfDone();
+    EXPECT_FALSE(cellularDataHandler->pdnBringUpPending_);
+    std::string dump = CellularDataPerfStats::Dump();
+    size_t pos = dump.find("PdnBringUp slot:0 ");
+    ASSERT_NE(pos, std::string::npos);
+    EXPECT_NE(dump.substr(pos, dump.find('\n', pos) - pos).find(" lastApns:2 "), std::string::npos);
+
+    // a detach abandons the bring-up of apns that did not connect yet
+    cellularDataHandler->pdnBringUpPending_ = true;
+    auto event = AppExecFwk::InnerEvent::Get(RadioEvent::RADIO_PS_CONNECTION_DETACHED);
+    cellularDataHandler->RadioPsConnectionDetached(event);
+    EXPECT_FALSE(cellularDataHandler->pdnBringUpPending_);
+}
+
+struct DispatchTestTarget {
+    void OnEvent(const AppExecFwk::InnerEvent::Pointer &event)
+    {
+        handled_ += 1;
+    }
+    void OnOtherEvent(const AppExecFwk::InnerEvent::Pointer &event)
+    {
+        handled_ += 2;
+    }
+    uint64_t handled_ = 0;
+};
+
+/**
+@tc.number Telephony_EventDispatchTable_001
+@tc.name EventDispatchTable_001
+@tc.desc Function test, entries given out of order are sorted and resolve to their handlers
+*/
+HWTEST_F(CellularDataHandlerTest, EventDispatchTable_001, Function | MediumTest | Level1)
+{
+    static constexpr auto dispatchTable = MakeEventDispatchTable<DispatchTestTarget, void>({
+        { CellularDataEventCode::BASE + 13, &DispatchTestTarget::OnOtherEvent },
+        { CellularDataEventCode::BASE + 0, &DispatchTestTarget::OnEvent },
+        { CellularDataEventCode::BASE + 29, &DispatchTestTarget::OnOtherEvent },
+        { CellularDataEventCode::BASE + 6, &DispatchTestTarget::OnEvent },
+        { CellularDataEventCode::BASE + 20, &DispatchTestTarget::OnEvent },
+        { CellularDataEventCode::BASE + 1, &DispatchTestTarget::OnOtherEvent },
+        { CellularDataEventCode::BASE + 10, &DispatchTestTarget::OnOtherEvent },
+        { CellularDataEventCode::BASE + 26, &DispatchTestTarget::OnEvent },
+        { CellularDataEventCode::BASE + 4, &DispatchTestTarget::OnOtherEvent },
+        { CellularDataEventCode::BASE + 14, &DispatchTestTarget::OnEvent },
+        { CellularDataEventCode::BASE + 9, &DispatchTestTarget::OnEvent },
+        { CellularDataEventCode::BASE + 23, &DispatchTestTarget::OnOtherEvent },
+        { CellularDataEventCode::BASE + 2, &DispatchTestTarget::OnEvent },
+        { CellularDataEventCode::BASE + 17, &DispatchTestTarget::OnOtherEvent },
+        { CellularDataEventCode::BASE + 7, &DispatchTestTarget::OnOtherEvent },
+        { CellularDataEventCode::BASE + 12, &DispatchTestTarget::OnEvent },
+    });
+    EXPECT_EQ(dispatchTable.Size(), 16u);
+    for (size_t i = 1; i < dispatchTable.Size(); i++) {
+        EXPECT_LT(dispatchTable.entries_[i - 1].eventId, dispatchTable.entries_[i].eventId);
+    }
+    EXPECT_EQ(dispatchTable.Find(CellularDataEventCode::BASE - 1), nullptr);
+    EXPECT_EQ(dispatchTable.Find(CellularDataEventCode::BASE + 3), nullptr);
+    EXPECT_EQ(dispatchTable.Find(CellularDataEventCode::BASE + 30), nullptr);
+    EXPECT_EQ(dispatchTable.Find(CellularDataEventCode::BASE + 0), &DispatchTestTarget::OnEvent);
+    EXPECT_EQ(dispatchTable.Find(CellularDataEventCode::BASE + 29), &DispatchTestTarget::OnOtherEvent);
+
+    DispatchTestTarget target;
+    auto event = AppExecFwk::InnerEvent::Get(0);
+    for (uint32_t eventId = CellularDataEventCode::BASE; eventId < CellularDataEventCode::BASE + 32; eventId++) {
+        auto handler = dispatchTable.Find(eventId);
+        if (handler != nullptr) {
+            (target.*handler)(event);
+        }
+    }
+    // eight ids go to OnEvent and eight to OnOtherEvent
+    EXPECT_EQ(target.handled_, 24u);
+}
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
@@ -16,10 +16,15 @@
 #define private public
 #define protected public
 
+#include <chrono>
+#include <thread>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "cellular_data_rdb_helper.h"
+#include "data_share_helper_pool.h"
+#include "ipc_object_stub.h"
 #include "pdp_profile_data.h"
+#include "mock/mock_data_share_helper.h"
 #include "mock/mock_data_share_result_set.h"
 
 using namespace testing;
@@ -31,6 +36,7 @@ namespace Telephony {
 
 static PdpProfile g_testPdpProfile;
 static int g_currentRow = 0;
+static constexpr int PDP_PROFILE_COLUMN_COUNT = 18;
 
 class CellularDataRdbHelperTest : public testing::Test {
 public:
@@ -219,5 +225,280 @@ HWTEST_F(CellularDataRdbHelperTest, ReadApnResult_UneditedMvnoApn, TestSize.Leve
     EXPECT_EQ(apnVec_.size(), 0);
 }
 
+/**
+ * @tc.number: CellularDataRdbHelper_ApnCache_HitAndMiss
+ * @tc.name: Test apn cache lookup
+ * @tc.desc: Verify that cached profiles are returned on hit and counters are updated
+ */
+HWTEST_F(CellularDataRdbHelperTest, ApnCache_HitAndMiss, TestSize.Level1)
+{
+    CellularDataRdbHelper helper;
+    std::string key = CellularDataRdbHelper::MakeApnCacheKey(1, "46001", "");
+    EXPECT_FALSE(helper.GetCachedApns(key, apnVec_));
+
+    PdpProfile profile;
+    profile.profileId = 1;
+    std::vector<PdpProfile> profiles = { profile };
+    helper.PutCachedApns(key, helper.GetApnCacheVersion(), profiles);
+    EXPECT_TRUE(helper.GetCachedApns(key, apnVec_));
+    ASSERT_EQ(apnVec_.size(), 1);
+    EXPECT_EQ(apnVec_[0].profileId, 1);
+    EXPECT_EQ(helper.apnCacheHitCount_.load(), 1);
+    EXPECT_EQ(helper.apnCacheMissCount_.load(), 1);
+
+    std::string mvnoKey = CellularDataRdbHelper::MakeApnCacheKey(1, "46001", "spn:test");
+    EXPECT_FALSE(helper.GetCachedApns(mvnoKey, apnVec_));
+    EXPECT_NE(helper.GetApnCacheDump().find("hit:1 miss:2"), std::string::npos);
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_ApnCache_Invalidate
+ * @tc.name: Test apn cache invalidation
+ * @tc.desc: Verify that invalidation drops entries and results of queries started before it
+ */
+HWTEST_F(CellularDataRdbHelperTest, ApnCache_Invalidate, TestSize.Level1)
+{
+    CellularDataRdbHelper helper;
+    std::string key = CellularDataRdbHelper::MakeApnCacheKey(1, "46001", "");
+    std::vector<PdpProfile> profiles(1);
+    uint64_t version = helper.GetApnCacheVersion();
+    helper.PutCachedApns(key, version, profiles);
+    helper.InvalidateApnCache();
+    EXPECT_FALSE(helper.GetCachedApns(key, apnVec_));
+
+    helper.PutCachedApns(key, version, profiles);
+    EXPECT_FALSE(helper.GetCachedApns(key, apnVec_));
+    helper.PutCachedApns(key, helper.GetApnCacheVersion(), profiles);
+    EXPECT_TRUE(helper.GetCachedApns(key, apnVec_));
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_ReadMvnoApnResult_BatchMatch
+ * @tc.name: Test batched mvno matching
+ * @tc.desc: Verify that rows from a single mvno query are matched against the sim data of their own type
+ */
+HWTEST_F(CellularDataRdbHelperTest, ReadMvnoApnResult_BatchMatch, TestSize.Level1)
+{
+    int rowCount = 2;
+    std::string mvnoValue = MvnoType::SPN;
+    EXPECT_CALL(*mockResultSet_, GetRowCount(_))
+        .Times(1)
+        .WillOnce(DoAll(SetArgReferee<0>(rowCount), Return(0)));
+    EXPECT_CALL(*mockResultSet_, GoToRow(_))
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(*mockResultSet_, GetColumnIndex(_, _))
+        .WillRepeatedly(DoAll(SetArgReferee<1>(0), Return(0)));
+    EXPECT_CALL(*mockResultSet_, GetInt(_, _))
+        .WillRepeatedly(DoAll(SetArgReferee<1>(0), Return(0)));
+    EXPECT_CALL(*mockResultSet_, GetString(_, _))
+        .WillRepeatedly(DoAll(SetArgReferee<1>(mvnoValue), Return(0)));
+
+    CellularDataRdbHelper helper;
+    std::vector<std::pair<std::string, std::string>> mvnoDataFromSim = {
+        { MvnoType::IMSI, "460011234567890" },
+        { MvnoType::SPN, mvnoValue },
+    };
+    helper.ReadMvnoApnResult(result_, mvnoDataFromSim, apnVec_);
+
+    ASSERT_EQ(apnVec_.size(), 2);
+    EXPECT_EQ(apnVec_[0].mvnoType, MvnoType::SPN);
+
+    apnVec_.clear();
+    helper.ReadMvnoApnResult(nullptr, mvnoDataFromSim, apnVec_);
+    EXPECT_EQ(apnVec_.size(), 0);
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_DataShareHelperPool_CreateFail
+ * @tc.name: Test helper pool when the helper can not be created
+ * @tc.desc: Verify that a failed creation is not cached and is retried on the next acquire
+ */
+HWTEST_F(CellularDataRdbHelperTest, DataShareHelperPool_CreateFail, TestSize.Level1)
+{
+    auto pool = std::make_shared<DataShareHelperPool>();
+    int32_t createTimes = 0;
+    auto creator = [&createTimes](sptr<IRemoteObject> &) -> std::shared_ptr<DataShare::DataShareHelper> {
+        createTimes++;
+        return nullptr;
+    };
+    EXPECT_EQ(pool->Acquire(creator), nullptr);
+    EXPECT_EQ(pool->Acquire(creator), nullptr);
+    EXPECT_EQ(pool->Acquire(nullptr), nullptr);
+    EXPECT_EQ(createTimes, 2);
+    EXPECT_EQ(pool->GetCreateCount(), 0);
+    EXPECT_EQ(pool->GetReuseCount(), 0);
+    pool->Invalidate();
+    EXPECT_EQ(pool->helper_, nullptr);
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_DataShareHelperPool_Hit
+ * @tc.name: Test helper pool reuse
+ * @tc.desc: Verify that the pooled helper is reused and released once after invalidation
+ */
+HWTEST_F(CellularDataRdbHelperTest, DataShareHelperPool_Hit, TestSize.Level1)
+{
+    auto pool = std::make_shared<DataShareHelperPool>();
+    auto mockHelper = std::make_shared<DataShareHelperMock>();
+    EXPECT_CALL(*mockHelper, Release()).Times(1).WillOnce(Return(true));
+    int32_t createTimes = 0;
+    auto creator = [&createTimes, mockHelper](sptr<IRemoteObject> &) -> std::shared_ptr<DataShare::DataShareHelper> {
+        createTimes++;
+        return mockHelper;
+    };
+    std::shared_ptr<DataShare::DataShareHelper> first = pool->Acquire(creator);
+    std::shared_ptr<DataShare::DataShareHelper> second = pool->Acquire(creator);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(createTimes, 1);
+    EXPECT_EQ(pool->GetCreateCount(), 1);
+    EXPECT_EQ(pool->GetReuseCount(), 1);
+    EXPECT_EQ(pool->GetDump(), "hit:1 miss:1 idleRelease:0 remoteDied:0");
+    pool->Invalidate();
+    EXPECT_EQ(pool->helper_, nullptr);
+    first = nullptr;
+    second = nullptr;
+    Mock::VerifyAndClearExpectations(mockHelper.get());
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_DataShareHelperPool_IdleExpiry
+ * @tc.name: Test helper pool idle release
+ * @tc.desc: Verify that a helper unused for longer than the idle timeout is released on the next acquire
+ */
+HWTEST_F(CellularDataRdbHelperTest, DataShareHelperPool_IdleExpiry, TestSize.Level1)
+{
+    constexpr int64_t idleTimeoutMs = 20;
+    auto pool = std::make_shared<DataShareHelperPool>(idleTimeoutMs);
+    auto mockHelper = std::make_shared<DataShareHelperMock>();
+    EXPECT_CALL(*mockHelper, Release()).Times(2).WillRepeatedly(Return(true));
+    auto creator = [mockHelper](sptr<IRemoteObject> &) -> std::shared_ptr<DataShare::DataShareHelper> {
+        return mockHelper;
+    };
+    EXPECT_NE(pool->Acquire(creator), nullptr);
+    EXPECT_NE(pool->Acquire(creator), nullptr);
+    EXPECT_EQ(pool->GetCreateCount(), 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(idleTimeoutMs * 2));
+    EXPECT_NE(pool->Acquire(creator), nullptr);
+    EXPECT_EQ(pool->GetCreateCount(), 2);
+    EXPECT_EQ(pool->idleReleaseCount_.load(), 1);
+    pool->Invalidate();
+    Mock::VerifyAndClearExpectations(mockHelper.get());
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_DataShareHelperPool_WatchRemote
+ * @tc.name: Test late provider watch of the helper pool
+ * @tc.desc: Verify that a provider reported for a helper that is no longer pooled is ignored
+ */
+HWTEST_F(CellularDataRdbHelperTest, DataShareHelperPool_WatchRemote, TestSize.Level1)
+{
+    auto pool = std::make_shared<DataShareHelperPool>();
+    auto mockHelper = std::make_shared<DataShareHelperMock>();
+    auto staleHelper = std::make_shared<DataShareHelperMock>();
+    EXPECT_CALL(*mockHelper, Release()).Times(1).WillOnce(Return(true));
+    auto creator = [mockHelper](sptr<IRemoteObject> &) -> std::shared_ptr<DataShare::DataShareHelper> {
+        return mockHelper;
+    };
+    EXPECT_NE(pool->Acquire(creator), nullptr);
+    sptr<IRemoteObject> remote = new IPCObjectStub(u"provider");
+    pool->WatchRemote(staleHelper.get(), remote);
+    pool->WatchRemote(nullptr, remote);
+    EXPECT_EQ(pool->watchedRemote_, nullptr);
+    EXPECT_EQ(pool->deathRecipient_, nullptr);
+    pool->Invalidate();
+    Mock::VerifyAndClearExpectations(mockHelper.get());
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_DataShareHelperPool_RemoteDied
+ * @tc.name: Test helper pool on remote death
+ * @tc.desc: Verify that the death of the watched remote drops the helper and the next acquire recreates it
+ */
+HWTEST_F(CellularDataRdbHelperTest, DataShareHelperPool_RemoteDied, TestSize.Level1)
+{
+    auto pool = std::make_shared<DataShareHelperPool>();
+    auto mockHelper = std::make_shared<DataShareHelperMock>();
+    EXPECT_CALL(*mockHelper, Release()).Times(2).WillRepeatedly(Return(true));
+    auto creator = [mockHelper](sptr<IRemoteObject> &) -> std::shared_ptr<DataShare::DataShareHelper> {
+        return mockHelper;
+    };
+    EXPECT_NE(pool->Acquire(creator), nullptr);
+    DataShareHelperPool::RemoteDeathRecipient recipient(pool);
+    recipient.OnRemoteDied(nullptr);
+    EXPECT_EQ(pool->helper_, nullptr);
+    EXPECT_EQ(pool->remoteDiedCount_.load(), 1);
+    EXPECT_NE(pool->Acquire(creator), nullptr);
+    EXPECT_EQ(pool->GetCreateCount(), 2);
+    pool->Invalidate();
+    Mock::VerifyAndClearExpectations(mockHelper.get());
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_ReadApnResult_ColumnIndexResolvedOnce
+ * @tc.name: Test column index lookups of the pdp profile decoder
+ * @tc.desc: Verify that column indices are resolved once per result set for 10, 100 and 1000 rows
+ */
+HWTEST_F(CellularDataRdbHelperTest, ReadApnResult_ColumnIndexResolvedOnce, TestSize.Level1)
+{
+    for (int rowCount : { 10, 100, 1000 }) {
+        auto mockResultSet = std::make_shared<DataShareResultSetMock>();
+        std::shared_ptr<DataShare::DataShareResultSet> result = mockResultSet;
+        EXPECT_CALL(*mockResultSet, GetRowCount(_))
+            .WillOnce(DoAll(SetArgReferee<0>(rowCount), Return(0)));
+        EXPECT_CALL(*mockResultSet, GetColumnIndex(_, _))
+            .Times(PDP_PROFILE_COLUMN_COUNT)
+            .WillRepeatedly(DoAll(SetArgReferee<1>(0), Return(0)));
+        EXPECT_CALL(*mockResultSet, GoToRow(_))
+            .Times(rowCount)
+            .WillRepeatedly(Return(0));
+        EXPECT_CALL(*mockResultSet, GetInt(_, _))
+            .WillRepeatedly(DoAll(SetArgReferee<1>(0), Return(0)));
+        // an empty mvno type keeps every row
+        EXPECT_CALL(*mockResultSet, GetString(_, _))
+            .WillRepeatedly(DoAll(SetArgReferee<1>(std::string("")), Return(0)));
+
+        CellularDataRdbHelper helper;
+        std::vector<PdpProfile> apnVec;
+        helper.ReadApnResult(result, apnVec);
+        EXPECT_EQ(apnVec.size(), static_cast<size_t>(rowCount));
+        Mock::VerifyAndClearExpectations(mockResultSet.get());
+    }
+}
+
+/**
+ * @tc.number: CellularDataRdbHelper_ReadMvnoApnResult_ColumnIndexResolvedOnce
+ * @tc.name: Test column index lookups of the mvno pdp profile decoder
+ * @tc.desc: Verify that column indices are resolved once per result set for 10, 100 and 1000 rows
+ */
+HWTEST_F(CellularDataRdbHelperTest, ReadMvnoApnResult_ColumnIndexResolvedOnce, TestSize.Level1)
+{
+    std::string apnValue = MvnoType::SPN;
+    for (int rowCount : { 10, 100, 1000 }) {
+        auto mockResultSet = std::make_shared<DataShareResultSetMock>();
+        std::shared_ptr<DataShare::DataShareResultSet> result = mockResultSet;
+        EXPECT_CALL(*mockResultSet, GetRowCount(_))
+            .WillOnce(DoAll(SetArgReferee<0>(rowCount), Return(0)));
+        EXPECT_CALL(*mockResultSet, GetColumnIndex(_, _))
+            .Times(PDP_PROFILE_COLUMN_COUNT)
+            .WillRepeatedly(DoAll(SetArgReferee<1>(0), Return(0)));
+        EXPECT_CALL(*mockResultSet, GoToRow(_))
+            .Times(rowCount)
+            .WillRepeatedly(Return(0));
+        EXPECT_CALL(*mockResultSet, GetInt(_, _))
+            .WillRepeatedly(DoAll(SetArgReferee<1>(0), Return(0)));
+        EXPECT_CALL(*mockResultSet, GetString(_, _))
+            .WillRepeatedly(DoAll(SetArgReferee<1>(apnValue), Return(0)));
+
+        CellularDataRdbHelper helper;
+        std::vector<PdpProfile> apnVec;
+        std::vector<std::pair<std::string, std::string>> mvnoDataFromSim = { { MvnoType::SPN, apnValue } };
+        helper.ReadMvnoApnResult(result, mvnoDataFromSim, apnVec);
+        ASSERT_EQ(apnVec.size(), static_cast<size_t>(rowCount));
+        EXPECT_EQ(apnVec.back().apn, apnValue);
+        Mock::VerifyAndClearExpectations(mockResultSet.get());
+    }
+}
+
 } // namespace Telephony
 } // namespace OHOS
@@ -180,10 +180,9 @@ HWTEST_F(CellularDataServiceTest, DataConnectionMonitor_HandleScreenStateChanged
 HWTEST_F(CellularDataServiceTest, DataConnectionMonitor_OnStallDetectionTimer_001, TestSize.Level1)
 {
     std::shared_ptr<DataConnectionMonitor> dataConnectionMonitor = std::make_shared<DataConnectionMonitor>(0);
-    dataConnectionMonitor->noRecvPackets_ = 20;
     dataConnectionMonitor->stallDetectionEnabled_ = true;
     dataConnectionMonitor->OnStallDetectionTimer();
-    ASSERT_EQ(dataConnectionMonitor->noRecvPackets_, 20);
+    ASSERT_FALSE(dataConnectionMonitor->stallDetector_.IsStalled());
 }
 
 /**
@@ -195,12 +194,13 @@ HWTEST_F(CellularDataServiceTest, DataConnectionMonitor_OnStallDetectionTimer_00
 {
     std::shared_ptr<DataConnectionMonitor> dataConnectionMonitor = std::make_shared<DataConnectionMonitor>(0);
     dataConnectionMonitor->stallDetectionEnabled_ = true;
-    dataConnectionMonitor->noRecvPackets_ = 11;
+    TrafficDelta silentRound;
+    silentRound.txPackets = 11;
+    dataConnectionMonitor->stallDetector_.AddSample(silentRound);
+    dataConnectionMonitor->stallDetector_.AddSample(silentRound);
     dataConnectionMonitor->OnStallDetectionTimer();
-    dataConnectionMonitor->noRecvPackets_ = 10;
     dataConnectionMonitor->dataRecoveryState_ = RecoveryState::STATE_REQUEST_CONTEXT_LIST;
     dataConnectionMonitor->OnStallDetectionTimer();
-    dataConnectionMonitor->noRecvPackets_ = 0;
     dataConnectionMonitor->dataRecoveryState_ = RecoveryState::STATE_RADIO_STATUS_RESTART;
     dataConnectionMonitor->OnStallDetectionTimer();
     dataConnectionMonitor->dataRecoveryState_ = RecoveryState::STATE_RADIO_STATUS_RESTART;
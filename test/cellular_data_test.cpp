@@ -1876,38 +1876,36 @@ HWTEST_F(CellularDataTest, QueryApns_001, TestSize.Level3)
 
 
 /**
- * @tc.number   QueryMvnoApnsByType_001
+ * @tc.number   QueryMvnoApns_001
  * @tc.name     Test the function
  * @tc.desc     Function test
  */
-HWTEST_F(CellularDataTest, QueryMvnoApnsByType_001, TestSize.Level3)
+HWTEST_F(CellularDataTest, QueryMvnoApns_001, TestSize.Level3)
 {
     std::string mcc = "123";
     std::string mnc = "456";
-    std::string mvnoType = "789";
-    std::string mvnoDataFromSim = "";
+    std::vector<std::pair<std::string, std::string>> mvnoDataFromSim = { { "789", "" } };
     std::vector<PdpProfile> mvnoApnVec;
     int32_t slotId = 0;
     CellularDataRdbHelper cellularDataRdbHelper;
-    bool result = cellularDataRdbHelper.QueryMvnoApnsByType(mcc, mnc, mvnoType, mvnoDataFromSim, mvnoApnVec, slotId);
+    bool result = cellularDataRdbHelper.QueryMvnoApns(mcc, mnc, mvnoDataFromSim, mvnoApnVec, slotId);
     ASSERT_TRUE(result);
 }
 
 /**
- * @tc.number   QueryMvnoApnsByType_002
+ * @tc.number   QueryMvnoApns_002
  * @tc.name     Test the function
  * @tc.desc     Function test
  */
-HWTEST_F(CellularDataTest, QueryMvnoApnsByType_002, TestSize.Level3)
+HWTEST_F(CellularDataTest, QueryMvnoApns_002, TestSize.Level3)
 {
     std::string mcc = "123";
     std::string mnc = "456";
-    std::string mvnoType = "789";
-    std::string mvnoDataFromSim = "012";
+    std::vector<std::pair<std::string, std::string>> mvnoDataFromSim = { { "789", "012" } };
     std::vector<PdpProfile> mvnoApnVec;
     int32_t slotId = 0;
     CellularDataRdbHelper cellularDataRdbHelper;
-    bool result = cellularDataRdbHelper.QueryMvnoApnsByType(mcc, mnc, mvnoType, mvnoDataFromSim, mvnoApnVec, slotId);
+    bool result = cellularDataRdbHelper.QueryMvnoApns(mcc, mnc, mvnoDataFromSim, mvnoApnVec, slotId);
     ASSERT_FALSE(result);
 }
 
@@ -2059,10 +2057,10 @@ HWTEST_F(CellularDataTest, CellularDataNetAgentGetSlotId001, TestSize.Level3)
     auto agent = std::make_shared<CellularDataNetAgent>();
     auto slotId = agent->GetSlotId(100);
     EXPECT_EQ(slotId, -1);
-    agent->slotIdSimId_[0] = 101;
+    agent->SetSlotSimId(0, 101);
     slotId = agent->GetSlotId(100);
     EXPECT_EQ(slotId, -1);
-    agent->slotIdSimId_[1] = 100;
+    agent->SetSlotSimId(1, 100);
     slotId = agent->GetSlotId(100);
     EXPECT_EQ(slotId, 1);
     slotId = agent->GetSlotId(101);
@@ -250,8 +250,7 @@ HWTEST_F(CellularStateMachineTest, IdleState_StateProcess_002, Function | Medium
     incallStateMachine->TransitionTo(incallStateMachine->idleState_);
     auto idleState = std::static_pointer_cast<IdleState>(incallStateMachine->idleState_);
     idleState->stateMachine_ = incallStateMachine;
-    idleState->eventIdFunMap_.clear();
-    auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_SM_INCALL_DATA_CALL_STARTED);
+    auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_SM_INCALL_DATA_DATA_CONNECTED);
     idleState->StateProcess(event);
     ASSERT_EQ(idleState->isActive_, NOT_PROCESSED);
 }
@@ -507,7 +506,6 @@ HWTEST_F(CellularStateMachineTest, SecondaryActiveStateProcess_003, Function | M
     auto secondaryActiveState =
         std::static_pointer_cast<SecondaryActiveState>(incallStateMachine->secondaryActiveState_);
     secondaryActiveState->stateMachine_ = incallStateMachine;
-    secondaryActiveState->eventIdFunMap_.clear();
     bool result = secondaryActiveState->StateProcess(event);
     EXPECT_EQ(result, NOT_PROCESSED);
 }
@@ -678,8 +676,7 @@ HWTEST_F(CellularStateMachineTest, DefaultStateProcess_001, Function | MediumTes
     }
     auto mDefault = std::static_pointer_cast<Default>(cellularMachine->defaultState_);
     mDefault->stateMachine_ = cellularMachine;
-    mDefault->eventIdFunMap_.clear();
-    auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_SM_CONNECT);
+    auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_SM_TEAR_DOWN_NOW);
     bool result = mDefault->StateProcess(event);
     EXPECT_EQ(result, false);
 }
@@ -699,7 +696,6 @@ HWTEST_F(CellularStateMachineTest, DefaultStateProcess_002, Function | MediumTes
     auto mDefault = std::static_pointer_cast<Default>(cellularMachine->defaultState_);
     cellularMachine = nullptr;
     mDefault->stateMachine_ = cellularMachine;
-    mDefault->eventIdFunMap_.clear();
     auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_SM_CONNECT);
     bool result = mDefault->StateProcess(event);
     EXPECT_EQ(result, false);
@@ -719,7 +715,6 @@ HWTEST_F(CellularStateMachineTest, DefaultProcessDisconnectDone_001, Function |
     }
     auto mDefault = std::static_pointer_cast<Default>(cellularMachine->defaultState_);
     mDefault->stateMachine_ = cellularMachine;
-    mDefault->eventIdFunMap_.clear();
     auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_SM_CONNECT);
     bool result = mDefault->ProcessDisconnectDone(event);
     EXPECT_EQ(result, true);
@@ -740,7 +735,6 @@ HWTEST_F(CellularStateMachineTest, DefaultProcessDisconnectDone_002, Function |
     auto mDefault = std::static_pointer_cast<Default>(cellularMachine->defaultState_);
     cellularMachine = nullptr;
     mDefault->stateMachine_ = cellularMachine;
-    mDefault->eventIdFunMap_.clear();
     auto event = AppExecFwk::InnerEvent::Get(CellularDataEventCode::MSG_SM_CONNECT);
     bool result = mDefault->ProcessDisconnectDone(event);
     EXPECT_EQ(result, false);
@@ -2401,5 +2395,44 @@ HWTEST_F(CellularStateMachineTest, DoConnect_001, Function | MediumTest | Level0
     cellularMachine->DoConnect(*dataConnectionParams);
     EXPECT_NE(cellularMachine->netInterfaceCallback_, nullptr);
 }
+
+/**
+ * @tc.number   UpdateNetworkInfoIfInActive_Coalesce_001
+ * @tc.name     test a burst of data call list updates is applied first and last only
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularStateMachineTest, UpdateNetworkInfoIfInActive_Coalesce_001, Function | MediumTest | Level1)
+{
+    std::shared_ptr<CellularMachineTest> machine = std::make_shared<CellularMachineTest>();
+    std::shared_ptr<CellularDataStateMachine> stateMachine = machine->CreateCellularDataConnect(0);
+    ASSERT_NE(stateMachine, nullptr);
+    SetupDataCallResultInfo info;
+    info.cid = 1;
+    auto before = std::chrono::steady_clock::now();
+    stateMachine->UpdateNetworkInfoIfInActive(info);
+    EXPECT_GT(stateMachine->coalesceWindowEnd_, before);
+    EXPECT_FALSE(stateMachine->trailingScheduled_);
+    auto windowEnd = stateMachine->coalesceWindowEnd_;
+
+    info.cid = 2;
+    stateMachine->UpdateNetworkInfoIfInActive(info);
+    EXPECT_TRUE(stateMachine->trailingScheduled_);
+    info.cid = 3;
+    stateMachine->UpdateNetworkInfoIfInActive(info);
+    EXPECT_TRUE(stateMachine->trailingScheduled_);
+    EXPECT_EQ(stateMachine->coalesceWindowEnd_, windowEnd);
+
+    std::shared_ptr<SetupDataCallResultInfo> latest = stateMachine->TakePendingNetworkInfo();
+    ASSERT_NE(latest, nullptr);
+    EXPECT_EQ(latest->cid, 3);
+    EXPECT_FALSE(stateMachine->trailingScheduled_);
+    EXPECT_EQ(stateMachine->TakePendingNetworkInfo(), nullptr);
+
+    stateMachine->coalesceWindowEnd_ = std::chrono::steady_clock::now();
+    info.cid = 4;
+    stateMachine->UpdateNetworkInfoIfInActive(info);
+    EXPECT_GT(stateMachine->coalesceWindowEnd_, windowEnd);
+    EXPECT_FALSE(stateMachine->trailingScheduled_);
+}
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
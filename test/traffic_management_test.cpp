@@ -16,19 +16,31 @@
 #define private public
 #define protected public
 
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <sys/stat.h>
+#include <vector>
+
 #include "mock/mock_net_conn_service.h"
 #include "mock/mock_sim_manager.h"
 #include "traffic_management.h"
+#include "cellular_data_net_agent.h"
 #include "core_manager_inner.h"
+#include "data_connection_monitor.h"
 #include "net_manager_constants.h"
 #include "net_conn_client.h"
 #include "net_link_info.h"
+#include "stall_detector.h"
 
 namespace OHOS {
 namespace Telephony {
 using namespace testing::ext;
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::Mock;
 using ::testing::Return;
 using ::testing::SetArgReferee;
@@ -158,5 +170,425 @@ HWTEST_F(TrafficManagementTest, TrafficManagementTest_004, Function | MediumTest
     Mock::VerifyAndClearExpectations(mockSimManager);
 }
 
+HWTEST_F(TrafficManagementTest, TrafficManagementTest_005, Function | MediumTest | Level1)
+{
+    // cached iface name and counters read from a fake statistics directory
+    const std::string rootPath = "/data/local/tmp/cellular_data_iface_stats/";
+    const std::string ifacePath = rootPath + "rmnet_test";
+    const std::string statsPath = ifacePath + "/statistics/";
+    mkdir(rootPath.c_str(), S_IRWXU);
+    mkdir(ifacePath.c_str(), S_IRWXU);
+    mkdir(statsPath.c_str(), S_IRWXU);
+    std::ofstream(statsPath + "tx_packets") << 100;
+    std::ofstream(statsPath + "rx_packets") << 200;
+    trafficManagement->SetIfaceStatsRootPath(rootPath);
+    CellularDataNetAgent::GetInstance().SetCellIfaceName(0, "rmnet_test");
+
+    EXPECT_CALL(*mockNetConnService, GetNetIdByIdentifier(_, _)).Times(0);
+    EXPECT_CALL(*mockNetConnService, GetConnectionProperties(_, _)).Times(0);
+    EXPECT_EQ(trafficManagement->GetIfaceName(), "rmnet_test");
+    trafficManagement->UpdatePacketData();
+    int64_t sendP = 0;
+    int64_t recvP = 0;
+    trafficManagement->GetPacketData(sendP, recvP);
+    EXPECT_EQ(sendP, 100);
+    EXPECT_EQ(recvP, 200);
+
+    CellularDataNetAgent::GetInstance().SetCellIfaceName(0, "");
+    EXPECT_TRUE(CellularDataNetAgent::GetInstance().GetCellIfaceName(0).empty());
+    std::remove((statsPath + "tx_packets").c_str());
+    std::remove((statsPath + "rx_packets").c_str());
+    rmdir(statsPath.c_str());
+    rmdir(ifacePath.c_str());
+    rmdir(rootPath.c_str());
+    Mock::VerifyAndClearExpectations(mockNetConnService);
+}
+
+struct CounterSample {
+    int64_t txPackets;
+    int64_t rxPackets;
+};
+
+// cumulative tx/rx packet counters of the cellular iface, one sample per stall detection round
+static const std::vector<CounterSample> IDLE_LINK_TRACE = {
+    { 100, 200 }, { 100, 200 }, { 100, 200 }, { 100, 200 }, { 100, 200 },
+};
+static const std::vector<CounterSample> STALLED_LINK_TRACE = {
+    { 100, 200 }, { 110, 200 }, { 125, 200 }, { 140, 200 }, { 150, 260 },
+};
+// a couple of retries per round, the window alone never holds enough unanswered packets
+static const std::vector<CounterSample> SLOW_STALL_LINK_TRACE = {
+    { 100, 200 }, { 102, 200 }, { 104, 200 }, { 104, 200 }, { 106, 200 }, { 108, 200 }, { 110, 200 },
+};
+
+static std::vector<int32_t> ReplayStallTrace(
+    DataConnectionMonitor &monitor, const std::string &statsPath, const std::vector<CounterSample> &trace)
+{
+    std::vector<int32_t> periods;
+    for (const CounterSample &sample : trace) {
+        std::ofstream(statsPath + "tx_packets") << sample.txPackets;
+        std::ofstream(statsPath + "rx_packets") << sample.rxPackets;
+        monitor.UpdateFlowInfo();
+        periods.push_back(monitor.GetStallDetectionPeriod());
+    }
+    return periods;
+}
+
+HWTEST_F(TrafficManagementTest, StallDetectionReplay_001, Function | MediumTest | Level1)
+{
+    const std::string rootPath = "/data/local/tmp/cellular_data_stall_trace/";
+    const std::string ifacePath = rootPath + "rmnet_test";
+    const std::string statsPath = ifacePath + "/statistics/";
+    mkdir(rootPath.c_str(), S_IRWXU);
+    mkdir(ifacePath.c_str(), S_IRWXU);
+    mkdir(statsPath.c_str(), S_IRWXU);
+    CellularDataNetAgent::GetInstance().SetCellIfaceName(0, "rmnet_test");
+
+    DataConnectionMonitor idleMonitor(0);
+    idleMonitor.stallDetectionTrafficManager_->SetIfaceStatsRootPath(rootPath);
+    idleMonitor.isScreenOn_ = true;
+    std::vector<int32_t> expected = { DATA_STALL_ALARM_AGGRESSIVE_DELAY_IN_MS_DEFAULT, 1000 * 20, 1000 * 40,
+        DATA_STALL_ALARM_SCREEN_ON_MAX_DELAY_IN_MS, DATA_STALL_ALARM_SCREEN_ON_MAX_DELAY_IN_MS };
+    EXPECT_EQ(ReplayStallTrace(idleMonitor, statsPath, IDLE_LINK_TRACE), expected);
+    idleMonitor.isScreenOn_ = false;
+    EXPECT_EQ(idleMonitor.GetStallDetectionPeriod(), DATA_STALL_ALARM_SCREEN_OFF_MAX_DELAY_IN_MS);
+
+    DataConnectionMonitor stalledMonitor(0);
+    stalledMonitor.stallDetectionTrafficManager_->SetIfaceStatsRootPath(rootPath);
+    stalledMonitor.isScreenOn_ = true;
+    expected = { DATA_STALL_ALARM_AGGRESSIVE_DELAY_IN_MS_DEFAULT, 1000 * 5, 2500, DATA_STALL_ALARM_MIN_DELAY_IN_MS,
+        DATA_STALL_ALARM_AGGRESSIVE_DELAY_IN_MS_DEFAULT };
+    EXPECT_EQ(ReplayStallTrace(stalledMonitor, statsPath, STALLED_LINK_TRACE), expected);
+    EXPECT_FALSE(stalledMonitor.stallDetector_.IsStalled());
+
+    DataConnectionMonitor slowStallMonitor(0);
+    slowStallMonitor.stallDetectionTrafficManager_->SetIfaceStatsRootPath(rootPath);
+    slowStallMonitor.isScreenOn_ = true;
+    std::ofstream(statsPath + "tx_packets") << SLOW_STALL_LINK_TRACE.front().txPackets;
+    std::ofstream(statsPath + "rx_packets") << SLOW_STALL_LINK_TRACE.front().rxPackets;
+    slowStallMonitor.UpdateFlowInfo();
+    std::vector<CounterSample> slowStallRounds(SLOW_STALL_LINK_TRACE.begin() + 1, SLOW_STALL_LINK_TRACE.end() - 1);
+    ReplayStallTrace(slowStallMonitor, statsPath, slowStallRounds);
+    EXPECT_FALSE(slowStallMonitor.stallDetector_.IsStalled());
+    ReplayStallTrace(slowStallMonitor, statsPath, { SLOW_STALL_LINK_TRACE.back() });
+    EXPECT_TRUE(slowStallMonitor.stallDetector_.IsStalled());
+
+    CellularDataNetAgent::GetInstance().SetCellIfaceName(0, "");
+    std::remove((statsPath + "tx_packets").c_str());
+    std::remove((statsPath + "rx_packets").c_str());
+    rmdir(statsPath.c_str());
+    rmdir(ifacePath.c_str());
+    rmdir(rootPath.c_str());
+}
+
+static TrafficDelta MakeTrafficDelta(int64_t txPackets, int64_t rxPackets)
+{
+    TrafficDelta delta;
+    delta.txPackets = txPackets;
+    delta.rxPackets = rxPackets;
+    return delta;
+}
+
+HWTEST_F(TrafficManagementTest, StallDetector_001, Function | MediumTest | Level1)
+{
+    StallDetector detector;
+    detector.AddSample(MakeTrafficDelta(50, 60));
+    detector.AddSample(MakeTrafficDelta(8, 0));
+    EXPECT_FALSE(detector.IsStalled());
+    detector.AddSample(MakeTrafficDelta(0, 0));
+    detector.AddSample(MakeTrafficDelta(6, 0));
+    EXPECT_EQ(detector.GetConfidence(), 66);
+    EXPECT_TRUE(detector.IsStalled());
+
+    // the latest round with traffic got an answer
+    detector.AddSample(MakeTrafficDelta(3, 1));
+    EXPECT_FALSE(detector.IsStalled());
+
+    // a stalled upload is not told apart from other unanswered traffic
+    detector.Reset();
+    detector.AddSample(MakeTrafficDelta(20, 0));
+    detector.AddSample(MakeTrafficDelta(20, 0));
+    EXPECT_TRUE(detector.IsStalled());
+
+    // an intermittent answer keeps the confidence under the threshold
+    StallDetectorConfig config;
+    config.confidencePercent = 80;
+    detector.SetConfig(config);
+    detector.Reset();
+    detector.AddSample(MakeTrafficDelta(10, 0));
+    detector.AddSample(MakeTrafficDelta(10, 5));
+    detector.AddSample(MakeTrafficDelta(10, 0));
+    detector.AddSample(MakeTrafficDelta(10, 0));
+    EXPECT_FALSE(detector.IsStalled());
+    detector.AddSample(MakeTrafficDelta(10, 0));
+    EXPECT_EQ(detector.GetConfidence(), 75);
+    EXPECT_FALSE(detector.IsStalled());
+    detector.AddSample(MakeTrafficDelta(10, 0));
+    EXPECT_TRUE(detector.IsStalled());
+}
+
+HWTEST_F(TrafficManagementTest, StallDetector_002, Function | MediumTest | Level1)
+{
+    // two retries per round never fill the window with the trigger count, the silent streak does
+    StallDetector detector;
+    detector.AddSample(MakeTrafficDelta(40, 50));
+    for (int32_t round = 0; round < 4; round++) {
+        detector.AddSample(MakeTrafficDelta(2, 0));
+        EXPECT_FALSE(detector.IsStalled());
+    }
+    detector.AddSample(MakeTrafficDelta(0, 0));
+    EXPECT_FALSE(detector.IsStalled());
+    detector.AddSample(MakeTrafficDelta(2, 0));
+    EXPECT_TRUE(detector.IsStalled());
+    EXPECT_EQ(detector.silentStreakTxPackets_, 10);
+
+    // an answer ends the streak
+    detector.AddSample(MakeTrafficDelta(2, 1));
+    EXPECT_EQ(detector.silentStreakTxPackets_, 0);
+    EXPECT_FALSE(detector.IsStalled());
+}
+
+HWTEST_F(TrafficManagementTest, RegisterNetSupplier_001, Function | MediumTest | Level1)
+{
+    CellularDataNetAgent &netAgent = CellularDataNetAgent::GetInstance();
+    std::vector<NetSupplier> savedSuppliers = netAgent.netSuppliers_;
+    netAgent.netSuppliers_.clear();
+    const int32_t capabilityCount = 13;
+    for (int32_t capability = 0; capability < capabilityCount; capability++) {
+        NetSupplier netSupplier;
+        netSupplier.slotId = 0;
+        netSupplier.capability = static_cast<uint64_t>(capability);
+        netAgent.netSuppliers_.push_back(netSupplier);
+    }
+    const uint32_t firstSupplierId = 100;
+    uint32_t nextSupplierId = firstSupplierId;
+    bool readerBlocked = true;
+    EXPECT_CALL(*mockSimManager, GetSimId(_)).WillOnce(Return(1));
+    EXPECT_CALL(*mockNetConnService, RegisterNetSupplier(_, _, _, _))
+        .Times(capabilityCount)
+        .WillRepeatedly(Invoke([&](NetManagerStandard::NetBearType, const std::string &,
+                                   const std::set<NetManagerStandard::NetCap> &, uint32_t &supplierId) {
+            if (nextSupplierId == firstSupplierId) {
+                // supplier id readers must not wait for the registration IPCs
+                auto reader = std::async(std::launch::async, [&netAgent]() { return netAgent.GetSupplierId(0, 0); });
+                readerBlocked = reader.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready;
+            }
+            supplierId = nextSupplierId++;
+            return NETMANAGER_SUCCESS;
+        }));
+    EXPECT_CALL(*mockNetConnService, RegisterNetSupplierCallback(_, _))
+        .Times(capabilityCount)
+        .WillRepeatedly(Return(NETMANAGER_SUCCESS));
+    EXPECT_CALL(*mockNetConnService, UpdateNetSupplierInfo(_, _))
+        .Times(capabilityCount)
+        .WillRepeatedly(Return(NETMANAGER_SUCCESS));
+    EXPECT_CALL(*mockNetConnService, RegisterSlotType(_, _))
+        .Times(capabilityCount)
+        .WillRepeatedly(Return(NETMANAGER_SUCCESS));
+
+    EXPECT_TRUE(netAgent.RegisterNetSupplier(0));
+    EXPECT_FALSE(readerBlocked);
+    EXPECT_EQ(netAgent.GetSupplierId(0, 0), static_cast<int32_t>(firstSupplierId));
+    int32_t regState = -1;
+    EXPECT_TRUE(netAgent.GetSupplierRegState(firstSupplierId + capabilityCount - 1, regState));
+    EXPECT_EQ(regState, NETMANAGER_SUCCESS);
+
+    netAgent.netSuppliers_ = savedSuppliers;
+    netAgent.PublishSupplierIndex();
+    Mock::VerifyAndClearExpectations(mockSimManager);
+    Mock::VerifyAndClearExpectations(mockNetConnService);
+}
+
+HWTEST_F(TrafficManagementTest, RegisterNetSupplier_002, Function | MediumTest | Level1)
+{
+    CellularDataNetAgent &netAgent = CellularDataNetAgent::GetInstance();
+    std::vector<NetSupplier> savedSuppliers = netAgent.netSuppliers_;
+    NetSupplier internet;
+    internet.slotId = 0;
+    internet.capability = NetManagerStandard::NetCap::NET_CAPABILITY_INTERNET;
+    netAgent.netSuppliers_ = { internet };
+    netAgent.PublishSupplierIndex();
+    const uint32_t registeredSupplierId = 300;
+    std::future<void> unregister;
+    bool unregisterBlocked = false;
+    EXPECT_CALL(*mockSimManager, GetSimId(_)).WillOnce(Return(1));
+    EXPECT_CALL(*mockNetConnService, RegisterNetSupplier(_, _, _, _))
+        .WillOnce(Invoke([&](NetManagerStandard::NetBearType, const std::string &,
+                             const std::set<NetManagerStandard::NetCap> &, uint32_t &supplierId) {
+            // a sim update arrives while the registration IPCs are in flight
+            unregister = std::async(std::launch::async, [&netAgent]() {
+                netAgent.UnregisterNetSupplierForSimUpdate(0);
+            });
+            unregisterBlocked = unregister.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready;
+            supplierId = registeredSupplierId;
+            return NETMANAGER_SUCCESS;
+        }));
+    EXPECT_CALL(*mockNetConnService, RegisterNetSupplierCallback(_, _)).WillOnce(Return(NETMANAGER_SUCCESS));
+    EXPECT_CALL(*mockNetConnService, UpdateNetSupplierInfo(_, _)).WillOnce(Return(NETMANAGER_SUCCESS));
+    EXPECT_CALL(*mockNetConnService, RegisterSlotType(_, _)).WillOnce(Return(NETMANAGER_SUCCESS));
+    // the unregister runs after the publish and sees the id that was just registered
+    EXPECT_CALL(*mockNetConnService, UnregisterNetSupplier(registeredSupplierId)).WillOnce(Return(NETMANAGER_SUCCESS));
+
+    EXPECT_TRUE(netAgent.RegisterNetSupplier(0));
+    ASSERT_TRUE(unregister.valid());
+    unregister.wait();
+    EXPECT_TRUE(unregisterBlocked);
+    ASSERT_EQ(netAgent.netSuppliers_.size(), 1u);
+    EXPECT_EQ(netAgent.netSuppliers_.front().supplierId, registeredSupplierId);
+    EXPECT_EQ(netAgent.netSuppliers_.front().simId, INVALID_SIM_ID);
+
+    netAgent.netSuppliers_ = savedSuppliers;
+    netAgent.PublishSupplierIndex();
+    Mock::VerifyAndClearExpectations(mockSimManager);
+    Mock::VerifyAndClearExpectations(mockNetConnService);
+}
+
+HWTEST_F(TrafficManagementTest, SupplierIndex_001, Function | MediumTest | Level1)
+{
+    CellularDataNetAgent &netAgent = CellularDataNetAgent::GetInstance();
+    std::vector<NetSupplier> savedSuppliers = netAgent.netSuppliers_;
+    netAgent.ClearNetSupplier();
+    EXPECT_EQ(netAgent.GetSupplierId(0, NetManagerStandard::NetCap::NET_CAPABILITY_INTERNET), 0);
+    NetSupplier internet;
+    internet.slotId = 1;
+    internet.capability = NetManagerStandard::NetCap::NET_CAPABILITY_INTERNET;
+    internet.supplierId = 200;
+    netAgent.AddNetSupplier(internet);
+    NetSupplier mms = internet;
+    mms.capability = NetManagerStandard::NetCap::NET_CAPABILITY_MMS;
+    mms.supplierId = 201;
+    netAgent.AddNetSupplier(mms);
+    EXPECT_EQ(netAgent.GetSupplierId(1, NetManagerStandard::NetCap::NET_CAPABILITY_INTERNET), 200);
+    EXPECT_EQ(netAgent.GetSupplierId(1, NetManagerStandard::NetCap::NET_CAPABILITY_MMS), 201);
+    EXPECT_EQ(netAgent.GetSupplierId(0, NetManagerStandard::NetCap::NET_CAPABILITY_MMS), 0);
+
+    EXPECT_CALL(*mockNetConnService, UpdateNetSupplierInfo(_, _)).WillOnce(Return(NETMANAGER_SUCCESS));
+    sptr<NetManagerStandard::NetSupplierInfo> netSupplierInfo = new NetManagerStandard::NetSupplierInfo();
+    netAgent.UpdateNetSupplierInfo(201, netSupplierInfo);
+    int32_t regState = -1;
+    EXPECT_TRUE(netAgent.GetSupplierRegState(201, regState));
+    EXPECT_EQ(regState, NETMANAGER_SUCCESS);
+    EXPECT_TRUE(netAgent.GetSupplierRegState(200, regState));
+    EXPECT_EQ(regState, -1);
+    EXPECT_FALSE(netAgent.GetSupplierRegState(202, regState));
+
+    // a new bandwidth is still pushed, but an unchanged regState keeps the published index
+    std::shared_ptr<const CellularDataNetAgent::SupplierIndex> index = std::atomic_load(&netAgent.supplierIndex_);
+    EXPECT_CALL(*mockNetConnService, UpdateNetSupplierInfo(_, _)).WillOnce(Return(NETMANAGER_SUCCESS));
+    netSupplierInfo->linkUpBandwidthKbps_ = 1000;
+    netAgent.UpdateNetSupplierInfo(201, netSupplierInfo);
+    EXPECT_EQ(std::atomic_load(&netAgent.supplierIndex_), index);
+
+    netAgent.ClearNetSupplier();
+    EXPECT_EQ(netAgent.GetSupplierId(1, NetManagerStandard::NetCap::NET_CAPABILITY_INTERNET), 0);
+    netAgent.netSuppliers_ = savedSuppliers;
+    netAgent.PublishSupplierIndex();
+    Mock::VerifyAndClearExpectations(mockNetConnService);
+}
+
+HWTEST_F(TrafficManagementTest, CellNetIdCache_001, Function | MediumTest | Level1)
+{
+    CellularDataNetAgent &netAgent = CellularDataNetAgent::GetInstance();
+    netAgent.InvalidateAllCellNetIdCache();
+    std::list<int32_t> netIdList = {5};
+    std::list<int32_t> netAllIds = {5};
+    // no link reported yet, every query takes the slow path
+    EXPECT_CALL(*mockSimManager, GetSimId(_)).Times(2).WillRepeatedly(Return(1));
+    EXPECT_CALL(*mockNetConnService, GetNetIdByIdentifier(_, _))
+        .Times(2)
+        .WillRepeatedly(DoAll(SetArgReferee<1>(netIdList), Return(0)));
+    EXPECT_CALL(*mockNetConnService, GetAllNets(_))
+        .Times(2)
+        .WillRepeatedly(DoAll(SetArgReferee<0>(netAllIds), Return(0)));
+    EXPECT_EQ(netAgent.GetCellNetId(0), 5);
+    EXPECT_EQ(netAgent.GetCellNetId(0), 5);
+    Mock::VerifyAndClearExpectations(mockNetConnService);
+
+    // the first query after the link is reported resolves the net id, the next ones are served from the cache
+    netAgent.ArmCellNetIdCache(0);
+    EXPECT_CALL(*mockSimManager, GetSimId(_)).WillOnce(Return(1));
+    EXPECT_CALL(*mockNetConnService, GetNetIdByIdentifier(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(netIdList), Return(0)));
+    EXPECT_CALL(*mockNetConnService, GetAllNets(_)).WillOnce(DoAll(SetArgReferee<0>(netAllIds), Return(0)));
+    uint64_t hits = netAgent.netIdCacheHits_.load();
+    EXPECT_EQ(netAgent.GetCellNetId(0), 5);
+    EXPECT_EQ(netAgent.GetCellNetId(0), 5);
+    EXPECT_EQ(netAgent.GetCellNetId(0), 5);
+    EXPECT_EQ(netAgent.netIdCacheHits_.load(), hits + 2);
+    Mock::VerifyAndClearExpectations(mockNetConnService);
+
+    // disconnect drops the cached net id
+    uint64_t invalidations = netAgent.netIdCacheInvalidations_.load();
+    netAgent.SetCellIfaceName(0, "");
+    EXPECT_EQ(netAgent.netIdCacheInvalidations_.load(), invalidations + 1);
+    EXPECT_TRUE(netAgent.cellNetId_.empty());
+    EXPECT_NE(netAgent.GetCellNetIdCacheDump().find("invalidations:"), std::string::npos);
+    Mock::VerifyAndClearExpectations(mockSimManager);
+}
+
+HWTEST_F(TrafficManagementTest, CellNetIdCache_002, Function | MediumTest | Level1)
+{
+    CellularDataNetAgent &netAgent = CellularDataNetAgent::GetInstance();
+    netAgent.InvalidateAllCellNetIdCache();
+    netAgent.ArmCellNetIdCache(0);
+    std::list<int32_t> netIdList = {5};
+    std::list<int32_t> netAllIds = {5};
+    // the slot reconnects while the query is in flight, its result belongs to the old link
+    EXPECT_CALL(*mockSimManager, GetSimId(_)).WillOnce(Return(1));
+    EXPECT_CALL(*mockNetConnService, GetNetIdByIdentifier(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(netIdList), Return(0)));
+    EXPECT_CALL(*mockNetConnService, GetAllNets(_))
+        .WillOnce(Invoke([&](std::list<int32_t> &nets) {
+            netAgent.SetCellIfaceName(0, "");
+            netAgent.ArmCellNetIdCache(0);
+            nets = netAllIds;
+            return 0;
+        }));
+    EXPECT_EQ(netAgent.GetCellNetId(0), 5);
+    ASSERT_EQ(netAgent.cellNetId_.count(0), 1u);
+    EXPECT_EQ(netAgent.cellNetId_[0], -1);
+    Mock::VerifyAndClearExpectations(mockNetConnService);
+    Mock::VerifyAndClearExpectations(mockSimManager);
+    netAgent.InvalidateAllCellNetIdCache();
+}
+
+/**
+ * @tc.number   NetInfoFingerprint_001
+ * @tc.name     test identical network information is pushed only once
+ * @tc.desc     Function test
+ */
+HWTEST_F(TrafficManagementTest, NetInfoFingerprint_001, Function | MediumTest | Level1)
+{
+    CellularDataNetAgent &netAgent = CellularDataNetAgent::GetInstance();
+    netAgent.ForgetPushedNetInfo(301);
+    sptr<NetManagerStandard::NetSupplierInfo> netSupplierInfo = new NetManagerStandard::NetSupplierInfo();
+    netSupplierInfo->isAvailable_ = true;
+    netSupplierInfo->linkUpBandwidthKbps_ = 100;
+    EXPECT_CALL(*mockNetConnService, UpdateNetSupplierInfo(301, _)).Times(2).WillRepeatedly(Return(NETMANAGER_SUCCESS));
+    uint64_t suppressed = netAgent.suppressedNetInfoPushes_.load();
+    EXPECT_EQ(netAgent.UpdateNetSupplierInfo(301, netSupplierInfo), NETMANAGER_SUCCESS);
+    EXPECT_EQ(netAgent.UpdateNetSupplierInfo(301, netSupplierInfo), NETMANAGER_SUCCESS);
+    EXPECT_EQ(netAgent.suppressedNetInfoPushes_.load(), suppressed + 1);
+    netSupplierInfo->linkUpBandwidthKbps_ = 200;
+    EXPECT_EQ(netAgent.UpdateNetSupplierInfo(301, netSupplierInfo), NETMANAGER_SUCCESS);
+    Mock::VerifyAndClearExpectations(mockNetConnService);
+
+    NetManagerStandard::NetLinkInfo linkInfo;
+    linkInfo.ifaceName_ = "rmnet0";
+    linkInfo.mtu_ = 1500;
+    NetManagerStandard::INetAddr dnsAddr;
+    dnsAddr.address_ = "8.8.8.8";
+    linkInfo.dnsList_.push_back(dnsAddr);
+    CellularDataNetAgent::PushedLinkInfo pushedLinkInfo = CellularDataNetAgent::MakePushedLinkInfo(linkInfo);
+    EXPECT_TRUE(CellularDataNetAgent::MakePushedLinkInfo(linkInfo) == pushedLinkInfo);
+    linkInfo.dnsList_.front().address_ = "8.8.4.4";
+    EXPECT_FALSE(CellularDataNetAgent::MakePushedLinkInfo(linkInfo) == pushedLinkInfo);
+    linkInfo.dnsList_.front().address_ = "8.8.8.8";
+    linkInfo.mtu_ = 1400;
+    EXPECT_FALSE(CellularDataNetAgent::MakePushedLinkInfo(linkInfo) == pushedLinkInfo);
+    netAgent.ForgetPushedNetInfo(301);
+    EXPECT_NE(netAgent.GetNetInfoPushDump().find("unchanged:"), std::string::npos);
+}
+
 }  // namespace Telephony
 }  // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define private public
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "apn_item.h"
+#include "cellular_data_rdb_helper.h"
+#include "datashare_result_set.h"
+#include "pdp_profile_data.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * In memory pdp profile table, the column lookup is a linear search over the column names like the
+ * shared block result set, so the cost of resolving the indices per row is not hidden.
+ */
+class PdpProfileResultSet : public DataShare::DataShareResultSet {
+public:
+    explicit PdpProfileResultSet(int rowCount) : rowCount_(rowCount)
+    {
+        columnNames_ = { PdpProfileData::PROFILE_ID, PdpProfileData::PROFILE_NAME, PdpProfileData::MCC,
+            PdpProfileData::MNC, PdpProfileData::APN, PdpProfileData::AUTH_USER, PdpProfileData::AUTH_TYPE,
+            PdpProfileData::AUTH_PWD, PdpProfileData::APN_TYPES, PdpProfileData::APN_PROTOCOL,
+            PdpProfileData::APN_ROAM_PROTOCOL, PdpProfileData::MVNO_TYPE, PdpProfileData::MVNO_MATCH_DATA,
+            PdpProfileData::EDITED_STATUS, PdpProfileData::PROXY_IP_ADDRESS, PdpProfileData::HOME_URL,
+            PdpProfileData::MMS_IP_ADDRESS, PdpProfileData::SERVER };
+    }
+    ~PdpProfileResultSet() override = default;
+
+    int GetRowCount(int &count) override
+    {
+        count = rowCount_;
+        return 0;
+    }
+
+    int GetColumnIndex(const std::string &columnName, int &columnIndex) override
+    {
+        columnIndexCount_++;
+        for (size_t i = 0; i < columnNames_.size(); i++) {
+            if (columnNames_[i] == columnName) {
+                columnIndex = static_cast<int>(i);
+                return 0;
+            }
+        }
+        columnIndex = -1;
+        return -1;
+    }
+
+    int GoToRow(int position) override
+    {
+        row_ = position;
+        return 0;
+    }
+
+    int GetInt(int columnIndex, int &value) override
+    {
+        // profile id, auth type and edited status are the int columns
+        value = (columnIndex == 0) ? row_ : 0;
+        return 0;
+    }
+
+    int GetString(int columnIndex, std::string &value) override
+    {
+        if (columnIndex < 0 || columnIndex >= static_cast<int>(columnNames_.size())) {
+            return -1;
+        }
+        // rows that are not mvno profiles are all kept by ReadApnResult
+        if (columnNames_[columnIndex] == PdpProfileData::MVNO_TYPE) {
+            value.clear();
+            return 0;
+        }
+        value = columnNames_[columnIndex] + std::to_string(row_ % ROW_VALUE_KINDS);
+        return 0;
+    }
+
+    uint64_t columnIndexCount_ = 0;
+
+private:
+    static constexpr int ROW_VALUE_KINDS = 16;
+    int rowCount_ = 0;
+    int row_ = 0;
+    std::vector<std::string> columnNames_;
+};
+
+/**
+ * Decode with the column indices resolved for every row, the way rows were read before ReadApnResult
+ * resolved them once per result set.
+ */
+static double RunPerRowLookup(CellularDataRdbHelper &helper, int rows, int rounds, uint64_t &lookups)
+{
+    auto resultSet = std::make_shared<PdpProfileResultSet>(rows);
+    std::shared_ptr<DataShare::DataShareResultSet> result = resultSet;
+    auto begin = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        std::vector<PdpProfile> apnVec;
+        for (int i = 0; i < rows; i++) {
+            PdpProfile apnBean;
+            helper.MakePdpProfile(result, i, apnBean);
+            apnVec.push_back(std::move(apnBean));
+        }
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+    lookups = resultSet->columnIndexCount_;
+    return static_cast<double>(costNs.count()) / (static_cast<double>(rows) * rounds);
+}
+
+static double RunReadApnResult(CellularDataRdbHelper &helper, int rows, int rounds, uint64_t &lookups)
+{
+    auto resultSet = std::make_shared<PdpProfileResultSet>(rows);
+    std::shared_ptr<DataShare::DataShareResultSet> result = resultSet;
+    auto begin = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        std::vector<PdpProfile> apnVec;
+        helper.ReadApnResult(result, apnVec);
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+    lookups = resultSet->columnIndexCount_;
+    return static_cast<double>(costNs.count()) / (static_cast<double>(rows) * rounds);
+}
+} // namespace Telephony
+} // namespace OHOS
+
+using namespace OHOS::Telephony;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3) {
+        std::cout << "usage: " << argv[0] << " <rows> <rounds>\n"
+                     "compares decoding a pdp profile result set with the column indices resolved per row\n"
+                     "and resolved once per result set by ReadApnResult" << std::endl;
+        return 1;
+    }
+    int rows = std::atoi(argv[1]);
+    int rounds = std::atoi(argv[2]);
+    if (rows <= 0 || rounds <= 0) {
+        std::cout << "invalid arguments" << std::endl;
+        return 1;
+    }
+    CellularDataRdbHelper helper;
+    uint64_t perRowLookups = 0;
+    uint64_t onceLookups = 0;
+    double perRowNs = RunPerRowLookup(helper, rows, rounds, perRowLookups);
+    double onceNs = RunReadApnResult(helper, rows, rounds, onceLookups);
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "per row lookup: " << perRowNs << " ns/row, column lookups " << perRowLookups << std::endl;
+    std::cout << "ReadApnResult : " << onceNs << " ns/row, column lookups " << onceLookups << std::endl;
+    return 0;
+}
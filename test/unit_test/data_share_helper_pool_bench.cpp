@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <gmock/gmock.h>
+
+#include "data_share_helper_pool.h"
+#include "mock/mock_data_share_helper.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Creator of a mock helper that stands for DataShareHelper::Create, the connect cost is spent in a
+ * busy loop so that it is not hidden by the scheduler.
+ */
+static std::shared_ptr<DataShare::DataShareHelper> CreateMockHelper(int64_t connectCostUs)
+{
+    auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(connectCostUs);
+    while (std::chrono::steady_clock::now() < end) {
+    }
+    auto helper = std::make_shared<testing::NiceMock<DataShareHelperMock>>();
+    ON_CALL(*helper, Release()).WillByDefault(testing::Return(true));
+    return helper;
+}
+
+static double RunPerCall(int32_t iterations, int64_t connectCostUs)
+{
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < iterations; i++) {
+        std::shared_ptr<DataShare::DataShareHelper> helper = CreateMockHelper(connectCostUs);
+        helper->Release();
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+    return static_cast<double>(costNs.count()) / iterations;
+}
+
+static double RunPooled(int32_t iterations, int64_t connectCostUs)
+{
+    auto pool = std::make_shared<DataShareHelperPool>();
+    auto creator = [connectCostUs](sptr<IRemoteObject> &) { return CreateMockHelper(connectCostUs); };
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < iterations; i++) {
+        std::shared_ptr<DataShare::DataShareHelper> helper = pool->Acquire(creator);
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+    std::cout << "pool " << pool->GetDump() << std::endl;
+    return static_cast<double>(costNs.count()) / iterations;
+}
+} // namespace Telephony
+} // namespace OHOS
+
+using namespace OHOS::Telephony;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        std::cout << "usage: " << argv[0] << " <iterations> [connect cost us]\n"
+                     "compares a helper created and released per operation with the pooled helper,\n"
+                     "the connect cost simulates DataShareHelper::Create, 0 by default" << std::endl;
+        return 1;
+    }
+    int32_t iterations = std::atoi(argv[1]);
+    int64_t connectCostUs = (argc > 2) ? std::atoll(argv[2]) : 0;
+    if (iterations <= 0 || connectCostUs < 0) {
+        std::cout << "invalid arguments" << std::endl;
+        return 1;
+    }
+    double perCallNs = RunPerCall(iterations, connectCostUs);
+    double pooledNs = RunPooled(iterations, connectCostUs);
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "per call: " << perCallNs << " ns/op" << std::endl;
+    std::cout << "pooled  : " << pooledNs << " ns/op" << std::endl;
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+#include "cellular_data_event_code.h"
+#include "event_dispatch_table.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * The ids are spread over a range twice as wide as the table, like the handler where about half of the
+ * inner events of one range are handled.
+ */
+constexpr uint32_t EVENT_ID_RANGE = 32;
+
+struct DispatchBenchTarget {
+    void OnEvent(const AppExecFwk::InnerEvent::Pointer &event)
+    {
+        handled_ += 1;
+    }
+    void OnOtherEvent(const AppExecFwk::InnerEvent::Pointer &event)
+    {
+        handled_ += 2;
+    }
+    uint64_t handled_ = 0;
+};
+
+static constexpr auto g_dispatchTable = MakeEventDispatchTable<DispatchBenchTarget, void>({
+    { CellularDataEventCode::BASE + 0, &DispatchBenchTarget::OnEvent },
+    { CellularDataEventCode::BASE + 1, &DispatchBenchTarget::OnOtherEvent },
+    { CellularDataEventCode::BASE + 2, &DispatchBenchTarget::OnEvent },
+    { CellularDataEventCode::BASE + 4, &DispatchBenchTarget::OnOtherEvent },
+    { CellularDataEventCode::BASE + 6, &DispatchBenchTarget::OnEvent },
+    { CellularDataEventCode::BASE + 7, &DispatchBenchTarget::OnOtherEvent },
+    { CellularDataEventCode::BASE + 9, &DispatchBenchTarget::OnEvent },
+    { CellularDataEventCode::BASE + 10, &DispatchBenchTarget::OnOtherEvent },
+    { CellularDataEventCode::BASE + 12, &DispatchBenchTarget::OnEvent },
+    { CellularDataEventCode::BASE + 13, &DispatchBenchTarget::OnOtherEvent },
+    { CellularDataEventCode::BASE + 14, &DispatchBenchTarget::OnEvent },
+    { CellularDataEventCode::BASE + 17, &DispatchBenchTarget::OnOtherEvent },
+    { CellularDataEventCode::BASE + 20, &DispatchBenchTarget::OnEvent },
+    { CellularDataEventCode::BASE + 23, &DispatchBenchTarget::OnOtherEvent },
+    { CellularDataEventCode::BASE + 26, &DispatchBenchTarget::OnEvent },
+    { CellularDataEventCode::BASE + 29, &DispatchBenchTarget::OnOtherEvent },
+});
+
+static double RunTable(uint32_t rounds, DispatchBenchTarget &target)
+{
+    auto event = AppExecFwk::InnerEvent::Get(0);
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        auto handler = g_dispatchTable.Find(CellularDataEventCode::BASE + (i % EVENT_ID_RANGE));
+        if (handler != nullptr) {
+            (target.*handler)(event);
+        }
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+    return static_cast<double>(costNs.count()) / rounds;
+}
+
+/**
+ * The std::map of std::function the handler used before the table, built from the same entries
+ */
+static double RunMap(uint32_t rounds, DispatchBenchTarget &target)
+{
+    using Fun = std::function<void(const AppExecFwk::InnerEvent::Pointer &event)>;
+    std::map<uint32_t, Fun> eventIdMap;
+    for (uint32_t eventId = CellularDataEventCode::BASE; eventId < CellularDataEventCode::BASE + EVENT_ID_RANGE;
+        eventId++) {
+        auto handler = g_dispatchTable.Find(eventId);
+        if (handler != nullptr) {
+            eventIdMap[eventId] = [&target, handler](const AppExecFwk::InnerEvent::Pointer &event) {
+                (target.*handler)(event);
+            };
+        }
+    }
+    auto event = AppExecFwk::InnerEvent::Get(0);
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        auto it = eventIdMap.find(CellularDataEventCode::BASE + (i % EVENT_ID_RANGE));
+        if (it != eventIdMap.end()) {
+            it->second(event);
+        }
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+    return static_cast<double>(costNs.count()) / rounds;
+}
+} // namespace Telephony
+} // namespace OHOS
+
+using namespace OHOS::Telephony;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        std::cout << "usage: " << argv[0] << " <rounds>\n"
+                     "compares the dispatch cost of the event dispatch table with a std::map of std::function"
+                  << std::endl;
+        return 1;
+    }
+    int64_t rounds = std::atoll(argv[1]);
+    if (rounds <= 0 || rounds > UINT32_MAX) {
+        std::cout << "invalid arguments" << std::endl;
+        return 1;
+    }
+    DispatchBenchTarget tableTarget;
+    DispatchBenchTarget mapTarget;
+    double tableNs = RunTable(static_cast<uint32_t>(rounds), tableTarget);
+    double mapNs = RunMap(static_cast<uint32_t>(rounds), mapTarget);
+    if (tableTarget.handled_ != mapTarget.handled_) {
+        std::cout << "dispatch mismatch, table: " << tableTarget.handled_ << " map: " << mapTarget.handled_
+                  << std::endl;
+        return 1;
+    }
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "dispatch table: " << tableNs << " ns/event" << std::endl;
+    std::cout << "std::map      : " << mapNs << " ns/event" << std::endl;
+    return 0;
+}
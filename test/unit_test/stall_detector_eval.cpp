@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cellular_data_constant.h"
+#include "stall_detector.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * One stall detection round of a recorded trace: the cumulative counters of the cellular interface
+ * and whether the link was really stalled at that time.
+ */
+struct TraceRound {
+    TrafficDelta counters;
+    bool stalled = false;
+};
+
+struct DetectorVariant {
+    std::string name;
+    bool legacyThreshold = false;
+    StallDetectorConfig config;
+};
+
+struct VariantScore {
+    int32_t episodes = 0;
+    int32_t detected = 0;
+    int32_t falseAlarms = 0;
+    int64_t latencyRounds = 0;
+};
+
+static bool LoadTrace(const std::string &path, std::vector<TraceRound> &trace)
+{
+    std::ifstream traceFile(path);
+    if (!traceFile.is_open()) {
+        std::cout << "can not open trace " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(traceFile, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        TraceRound round;
+        int32_t stalled = 0;
+        if (!(fields >> round.counters.txPackets >> round.counters.rxPackets >> stalled)) {
+            std::cout << "bad line in " << path << ": " << line << std::endl;
+            return false;
+        }
+        round.stalled = (stalled != 0);
+        trace.push_back(round);
+    }
+    return true;
+}
+
+static std::vector<DetectorVariant> BuildVariants()
+{
+    std::vector<DetectorVariant> variants;
+    DetectorVariant legacy;
+    legacy.name = "legacy-threshold";
+    legacy.legacyThreshold = true;
+    variants.push_back(legacy);
+
+    DetectorVariant base;
+    base.name = "window-default";
+    variants.push_back(base);
+
+    DetectorVariant strict = base;
+    strict.name = "window6-conf80";
+    strict.config.windowSize = 6;
+    strict.config.confidencePercent = 80;
+    variants.push_back(strict);
+
+    DetectorVariant eager = base;
+    eager.name = "single-round";
+    eager.config.minSilentRounds = 1;
+    variants.push_back(eager);
+    return variants;
+}
+
+static void ScoreTrace(const DetectorVariant &variant, const std::vector<TraceRound> &trace, VariantScore &score)
+{
+    StallDetector detector(variant.config);
+    int64_t noRecvPackets = 0;
+    int32_t episodeStart = -1;
+    bool episodeDetected = false;
+    for (size_t i = 1; i < trace.size(); i++) {
+        TrafficDelta delta;
+        delta.txPackets = trace[i].counters.txPackets - trace[i - 1].counters.txPackets;
+        delta.rxPackets = trace[i].counters.rxPackets - trace[i - 1].counters.rxPackets;
+        bool triggered = false;
+        if (variant.legacyThreshold) {
+            if (delta.txPackets > 0 && delta.rxPackets == 0) {
+                noRecvPackets += delta.txPackets;
+            } else if (delta.rxPackets > 0) {
+                noRecvPackets = 0;
+            }
+            triggered = noRecvPackets > RECOVERY_TRIGGER_PACKET;
+        } else {
+            detector.AddSample(delta);
+            triggered = detector.IsStalled();
+        }
+        if (trace[i].stalled && episodeStart < 0) {
+            episodeStart = static_cast<int32_t>(i);
+            episodeDetected = false;
+            score.episodes++;
+        } else if (!trace[i].stalled) {
+            episodeStart = -1;
+        }
+        if (!triggered) {
+            continue;
+        }
+        // the monitor starts the recovery and forgets the window
+        noRecvPackets = 0;
+        detector.Reset();
+        if (episodeStart < 0) {
+            score.falseAlarms++;
+        } else if (!episodeDetected) {
+            episodeDetected = true;
+            score.detected++;
+            score.latencyRounds += static_cast<int32_t>(i) - episodeStart + 1;
+        }
+    }
+}
+
+static void PrintScores(const std::vector<DetectorVariant> &variants, const std::vector<VariantScore> &scores)
+{
+    std::cout << std::left << std::setw(20) << "variant" << std::setw(10) << "episodes" << std::setw(10) <<
+        "detected" << std::setw(8) << "missed" << std::setw(14) << "false alarms" << "mean latency" << std::endl;
+    for (size_t i = 0; i < variants.size(); i++) {
+        const VariantScore &score = scores[i];
+        std::cout << std::left << std::setw(20) << variants[i].name << std::setw(10) << score.episodes <<
+            std::setw(10) << score.detected << std::setw(8) << (score.episodes - score.detected) << std::setw(14) <<
+            score.falseAlarms;
+        if (score.detected > 0) {
+            std::cout << std::fixed << std::setprecision(2) <<
+                static_cast<double>(score.latencyRounds) / score.detected << " rounds";
+        } else {
+            std::cout << "-";
+        }
+        std::cout << std::endl;
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
+
+using namespace OHOS::Telephony;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        std::cout << "usage: " << argv[0] << " <trace file>...\n"
+                     "each trace line holds the cumulative counters of one stall detection round:\n"
+                     "  <tx packets> <rx packets> <1 if the link is stalled, else 0>\n"
+                     "lines starting with # are ignored" << std::endl;
+        return 1;
+    }
+    std::vector<DetectorVariant> variants = BuildVariants();
+    std::vector<VariantScore> scores(variants.size());
+    for (int i = 1; i < argc; i++) {
+        std::vector<TraceRound> trace;
+        if (!LoadTrace(argv[i], trace)) {
+            return 1;
+        }
+        for (size_t j = 0; j < variants.size(); j++) {
+            ScoreTrace(variants[j], trace, scores[j]);
+        }
+    }
+    PrintScores(variants, scores);
+    return 0;
+}
@@ -1799,7 +1799,8 @@ HWTEST_F(BranchTest, ApnManager_Test_01, Function | MediumTest | Level3)
     helper->ResetApns(0);
     std::shared_ptr<DataShare::DataShareResultSet> result = nullptr;
     std::vector<PdpProfile> apnVec;
-    helper->ReadMvnoApnResult(result, "", apnVec);
+    std::vector<std::pair<std::string, std::string>> mvnoDataFromSim;
+    helper->ReadMvnoApnResult(result, mvnoDataFromSim, apnVec);
     PdpProfile apnBean;
     ASSERT_FALSE(helper->IsMvnoDataMatched("", apnBean));
     apnBean.mvnoType = MvnoType::ICCID;
@@ -2470,7 +2471,7 @@ HWTEST_F(BranchTest, JudgingDataActivateTimeOut_001, Function | MediumTest | Lev
 HWTEST_F(BranchTest, ReadMvnoApnResult_001, TestSize.Level3)
 {
     std::shared_ptr<DataShare::DataShareResultSet> result = nullptr;
-    std::string mvnoDataFromSim = "mvnoDataFromSim";
+    std::vector<std::pair<std::string, std::string>> mvnoDataFromSim = { { MvnoType::SPN, "mvnoDataFromSim" } };
     std::vector<PdpProfile> apnVec;
     CellularDataRdbHelper cellularDataRdbHelper;
     cellularDataRdbHelper.ReadMvnoApnResult(nullptr, mvnoDataFromSim, apnVec);
@@ -2485,7 +2486,7 @@ HWTEST_F(BranchTest, ReadMvnoApnResult_001, TestSize.Level3)
 HWTEST_F(BranchTest, ReadMvnoApnResult_002, TestSize.Level3)
 {
     std::shared_ptr<DataShare::DataShareResultSet> result = std::make_shared<DataShare::DataShareResultSet>();
-    std::string mvnoDataFromSim = "mvnoDataFromSim";
+    std::vector<std::pair<std::string, std::string>> mvnoDataFromSim = { { MvnoType::SPN, "mvnoDataFromSim" } };
     std::vector<PdpProfile> apnVec;
     CellularDataRdbHelper cellularDataRdbHelper;
     cellularDataRdbHelper.ReadMvnoApnResult(nullptr, mvnoDataFromSim, apnVec);
@@ -2781,6 +2782,33 @@ HWTEST_F(BranchTest, GetDefaultTcpBufferConfig_003, Function | MediumTest | Leve
     ASSERT_GT(con.tcpBufferConfigMap_.size(), 0);
 }
 
+/**
+ * @tc.number   LinkConfigTable_001
+ * @tc.name     test bandwidth and tcp buffer lookups use the table published with the config
+ * @tc.desc     Function test
+ */
+HWTEST_F(BranchTest, LinkConfigTable_001, Function | MediumTest | Level3)
+{
+    DataConnectionManager con { 0 };
+    con.Init();
+    ASSERT_TRUE(con.linkConfigTable_ == nullptr);
+    ASSERT_EQ("", con.GetTcpBufferByRadioTech(static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_WCDMA)));
+    system::SetParameter(CONFIG_TCP_BUFFER, DEFAULT_TCP_BUFFER_CONFIG);
+    con.GetDefaultTcpBufferConfig();
+    con.GetDefaultBandWidthsConfig();
+    ASSERT_TRUE(con.linkConfigTable_ != nullptr);
+    ASSERT_EQ(con.tcpBufferConfigMap_["UMTS"], con.GetTcpBufferByRadioTech(
+        static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_WCDMA)));
+    LinkBandwidthInfo linkBandwidthInfo;
+    bool hasNsaBandwidth = con.bandwidthConfigMap_.find("NR_NSA") != con.bandwidthConfigMap_.end();
+    ASSERT_EQ(hasNsaBandwidth, con.linkConfigTable_->GetBandwidth(
+        static_cast<int32_t>(RadioTech::RADIO_TECHNOLOGY_LTE), LinkConfigNrMode::NR_MODE_NSA, linkBandwidthInfo));
+    ASSERT_EQ(linkBandwidthInfo.downBandwidth, con.bandwidthConfigMap_["NR_NSA"].downBandwidth);
+    ASSERT_FALSE(con.linkConfigTable_->GetBandwidth(-1, LinkConfigNrMode::NR_MODE_NONE, linkBandwidthInfo));
+    ASSERT_EQ(LinkConfigTable::GetNrMode(NrState::NR_NSA_STATE_DUAL_CONNECTED, FrequencyType::FREQ_TYPE_MMWAVE),
+        LinkConfigNrMode::NR_MODE_NSA_MMWAVE);
+}
+
 HWTEST_F(BranchTest, CellularDataUtils_IsTstsModeEnabled_001, Function | MediumTest | Level3)
 {
     system::SetParameter(PERSIST_TSTS_MODE, "0");